@@ -42,6 +42,11 @@ export default polygenConfig({
   modules: [
     localModule('src/example.wasm'),
     localModule('src/table_test.wasm'),
+    localModule('src/benchmark.wasm', {
+      bridge: {
+        multiValueResultBuffer: ['divmod'],
+      },
+    }),
     externalModule('simple-sha256-wasm', 'simple_sha256_wasm_bg.wasm'),
     // localModule('src/wasm/module.wasm')
   ],
@@ -20,6 +20,7 @@ import {
 } from '@react-navigation/native';
 import { createStackNavigator } from '@react-navigation/stack';
 import { SafeAreaProvider } from 'react-native-safe-area-context';
+import BenchmarkExample from './examples/BenchmarkExample';
 import ExternalModuleExample from './examples/ExternalModuleExample';
 import FetchModuleExample from './examples/FetchExample';
 import ImportValidationExample from './examples/ImportValidationExample';
@@ -47,6 +48,10 @@ const examples = [
     component: TableExample,
     title: 'Table Example',
   },
+  {
+    component: BenchmarkExample,
+    title: 'Benchmarks',
+  },
 ];
 
 const Stack = createStackNavigator();
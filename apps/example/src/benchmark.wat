@@ -0,0 +1,25 @@
+;; Source of benchmark.wasm, used by the Benchmarks screen.
+;;
+;; Rebuild with `wat2wasm --enable-multi-value benchmark.wat -o benchmark.wasm`.
+(module
+  ;; Memory and data initialized for every new instance, and reset by instance pools
+  (memory 16)
+  (data (i32.const 1024) "Data applied to the memory of every new instance")
+
+  ;; Returns values using the result buffer, see `polygen.config.mjs`
+  (func (export "divmod") (param i32 i32) (result i32 i32)
+    local.get 0
+    local.get 1
+    i32.div_s
+    local.get 0
+    local.get 1
+    i32.rem_s)
+
+  ;; Same as `divmod`, returning an array
+  (func (export "divmodArray") (param i32 i32) (result i32 i32)
+    local.get 0
+    local.get 1
+    i32.div_s
+    local.get 0
+    local.get 1
+    i32.rem_s))
@@ -0,0 +1,163 @@
+import { useCallback, useState } from 'react';
+import { Button, ScrollView, StyleSheet, Text } from 'react-native';
+import { WebAssembly as Polygen } from '@callstack/polygen';
+import benchmark from '../benchmark.wasm';
+import example from '../example.wasm';
+
+/**
+ * Number of imported function calls made by a single call of `fib`.
+ */
+const IMPORT_CALLS = 10_000;
+
+/**
+ * Number of calls of functions returning multiple values.
+ */
+const RESULT_CALLS = 100_000;
+
+/**
+ * Number of instances created, or acquired from a pool.
+ */
+const INSTANCES = 1_000;
+
+type GCStats = {
+  js_numGCs: number;
+  js_gcTime: number;
+  js_totalAllocatedBytes: number;
+};
+
+/**
+ * Returns statistics of the Hermes garbage collector, or undefined on other engines.
+ */
+function getGCStats(): GCStats | undefined {
+  return (globalThis as any).HermesInternal?.getInstrumentedStats?.();
+}
+
+/**
+ * Calls `operation` `iterations` times after a warm-up, returning mean duration of a call in microseconds.
+ */
+function measure(iterations: number, operation: () => void): number {
+  for (let i = 0; i < Math.min(iterations, 100); i++) {
+    operation();
+  }
+
+  const start = performance.now();
+  for (let i = 0; i < iterations; i++) {
+    operation();
+  }
+  return ((performance.now() - start) * 1000) / iterations;
+}
+
+/**
+ * Measures `operation` as `measure()` does, along with garbage collections and memory it caused.
+ */
+function measureWithGC(iterations: number, operation: () => void): string {
+  const before = getGCStats();
+  const duration = measure(iterations, operation);
+  const after = getGCStats();
+
+  const time = `${(duration * 1000).toFixed(0)} ns per call`;
+  if (!before || !after) {
+    return time;
+  }
+
+  const collections = after.js_numGCs - before.js_numGCs;
+  const gcTime = (after.js_gcTime - before.js_gcTime) * 1000;
+  const allocated =
+    (after.js_totalAllocatedBytes - before.js_totalAllocatedBytes) /
+    iterations;
+  return `${time}, ${collections} GCs taking ${gcTime.toFixed(1)} ms, ${allocated.toFixed(0)} bytes allocated per call`;
+}
+
+/**
+ * Benchmarks use the standard WebAssembly API where possible, so running them on an earlier
+ * version of Polygen measures the cost before a change. Polygen extensions are compared
+ * with the standard API they replace.
+ */
+const benchmarks: { name: string; run: () => string }[] = [
+  {
+    name: 'Imported function call',
+    run() {
+      const module = new WebAssembly.Module(example);
+      const instance = new WebAssembly.Instance(module, {
+        host: { add: (a: number, b: number) => a + b },
+      });
+
+      // `fib(n)` calls imported `add` n - 1 times
+      const fib = instance.exports.fib as (n: number) => number;
+      const withoutImports = measure(1000, () => fib(1));
+      const withImports = measure(100, () => fib(IMPORT_CALLS + 1));
+
+      const perCall = ((withImports - withoutImports) * 1000) / IMPORT_CALLS;
+      return `${perCall.toFixed(1)} ns per call`;
+    },
+  },
+  {
+    name: 'Multi-value result',
+    run() {
+      const instance = new Polygen.Instance(new Polygen.Module(benchmark));
+      const { divmod, divmodArray } = instance.exports as {
+        divmod: (a: number, b: number) => number;
+        divmodArray: (a: number, b: number) => [number, number];
+      };
+      const results = instance.results!;
+
+      let sum = 0;
+      const buffer = measureWithGC(RESULT_CALLS, () => {
+        const count = divmod(7, 2);
+        sum += results[0]! + results[count - 1]!;
+      });
+      const array = measureWithGC(RESULT_CALLS, () => {
+        const [quotient, remainder] = divmodArray(7, 2);
+        sum += quotient + remainder;
+      });
+
+      return `result buffer ${buffer}; array ${array} (checksum ${sum})`;
+    },
+  },
+  {
+    name: 'Instance creation',
+    run() {
+      const module = new Polygen.Module(benchmark);
+      const created = measure(INSTANCES, () => {
+        new Polygen.Instance(module);
+      });
+
+      const pool = new Polygen.InstancePool(module);
+      const pooled = measure(INSTANCES, () => {
+        pool.release(pool.acquire());
+      });
+
+      return `new instance ${created.toFixed(1)} µs; acquired from pool and released ${pooled.toFixed(1)} µs`;
+    },
+  },
+];
+
+export default function BenchmarkExample() {
+  const [results, setResults] = useState<string[]>([]);
+
+  const runBenchmarks = useCallback(() => {
+    const lines = benchmarks.map(({ name, run }) => `${name}: ${run()}`);
+    lines.forEach((line) => console.log(`[benchmark] ${line}`));
+    setResults(lines);
+  }, []);
+
+  return (
+    <ScrollView contentContainerStyle={styles.container}>
+      <Text>
+        Run in a release build, results are also printed to the Metro console.
+      </Text>
+      <Button title="Run benchmarks" onPress={runBenchmarks} />
+      {results.map((line) => (
+        <Text key={line}>{line}</Text>
+      ))}
+    </ScrollView>
+  );
+}
+
+const styles = StyleSheet.create({
+  container: {
+    alignItems: 'center',
+    justifyContent: 'center',
+    padding: 5,
+  },
+});
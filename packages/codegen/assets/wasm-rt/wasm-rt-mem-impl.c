@@ -22,7 +22,29 @@
 #ifdef _WIN32
 #include <windows.h>
 #else
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
 #include <sys/mman.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+#endif
+
+/*
+ * Enables experimental lazy population of large data segments with
+ * userfaultfd, on Linux and Android.
+ */
+#ifndef POLYGEN_USE_USERFAULTFD
+#define POLYGEN_USE_USERFAULTFD 0
+#endif
+
+#if WASM_RT_USE_MMAP && defined(__linux__) && POLYGEN_USE_USERFAULTFD
+#include <errno.h>
+#include <linux/userfaultfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
 #endif
 
 #define WASM_PAGE_SIZE 65536
@@ -67,6 +89,491 @@ extern void WASM_RT_GROW_FAILED_HANDLER();
 #define WIN_MEMORY_LOCK_AQUIRE(name) EnterCriticalSection(&(name))
 #define WIN_MEMORY_LOCK_RELEASE(name) LeaveCriticalSection(&(name))
 
+/*
+ * Decompresses LZ4 blocks of data segments compressed by codegen.
+ *
+ * Literals and matches are copied in fixed 16 byte chunks, which compilers lower
+ * to vector loads and stores, as long as there is room for the last chunk to
+ * overshoot. Bytes written past a sequence are overwritten by the following ones,
+ * and nothing is ever written past the end of the segment, as the bytes
+ * following it may belong to another segment.
+ */
+#define LZ4_MIN_MATCH 4
+#define LZ4_COPY_SIZE 16
+
+static bool lz4_read_length(const uint8_t** src,
+                            const uint8_t* src_end,
+                            size_t* length) {
+  uint8_t byte;
+  do {
+    if (*src >= src_end) {
+      return false;
+    }
+    byte = *(*src)++;
+    *length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+static inline void lz4_wild_copy(uint8_t* dst,
+                                  const uint8_t* src,
+                                  size_t length) {
+  uint8_t* end = dst + length;
+  do {
+    memcpy(dst, src, LZ4_COPY_SIZE);
+    dst += LZ4_COPY_SIZE;
+    src += LZ4_COPY_SIZE;
+  } while (dst < end);
+}
+
+static void lz4_copy_match(uint8_t* dst,
+                           size_t room,
+                           size_t offset,
+                           size_t length) {
+  const uint8_t* ref = dst - offset;
+  if (offset >= LZ4_COPY_SIZE && length + LZ4_COPY_SIZE <= room) {
+    lz4_wild_copy(dst, ref, length);
+  } else if (offset >= length) {
+    memcpy(dst, ref, length);
+  } else if (offset == 1) {
+    memset(dst, *ref, length);
+  } else {
+    /* Overlapping match repeats the last offset bytes */
+    while (length-- > 0) {
+      *dst++ = *ref++;
+    }
+  }
+}
+
+static bool lz4_decompress(const uint8_t* src,
+                           size_t src_size,
+                           uint8_t* dst,
+                           size_t dst_size) {
+  const uint8_t* src_end = src + src_size;
+  uint8_t* const dst_start = dst;
+  uint8_t* const dst_end = dst + dst_size;
+
+  while (src < src_end) {
+    uint8_t token = *src++;
+
+    size_t literal_length = token >> 4;
+    if (literal_length == 15 &&
+        !lz4_read_length(&src, src_end, &literal_length)) {
+      return false;
+    }
+    if (literal_length > (size_t)(src_end - src) ||
+        literal_length > (size_t)(dst_end - dst)) {
+      return false;
+    }
+    if (literal_length + LZ4_COPY_SIZE <= (size_t)(src_end - src) &&
+        literal_length + LZ4_COPY_SIZE <= (size_t)(dst_end - dst)) {
+      lz4_wild_copy(dst, src, literal_length);
+    } else {
+      memcpy(dst, src, literal_length);
+    }
+    src += literal_length;
+    dst += literal_length;
+
+    /* Last sequence has no match */
+    if (src == src_end) {
+      break;
+    }
+
+    if (src_end - src < 2) {
+      return false;
+    }
+    size_t offset = (size_t)src[0] | ((size_t)src[1] << 8);
+    src += 2;
+
+    size_t match_length = token & 15;
+    if (match_length == 15 && !lz4_read_length(&src, src_end, &match_length)) {
+      return false;
+    }
+    match_length += LZ4_MIN_MATCH;
+
+    if (offset == 0 || offset > (size_t)(dst - dst_start) ||
+        match_length > (size_t)(dst_end - dst)) {
+      return false;
+    }
+    lz4_copy_match(dst, (size_t)(dst_end - dst), offset, match_length);
+    dst += match_length;
+  }
+
+  return dst == dst_end;
+}
+
+#undef LZ4_MIN_MATCH
+#undef LZ4_COPY_SIZE
+
+
+/*
+ * Compressed segments are split into chunks ending at multiples of
+ * POLYGEN_COMPRESSED_DATA_CHUNK_SIZE in memory, each compressed as a separate
+ * LZ4 block, so that any part of a segment can be decompressed on its own.
+ *
+ * Data of such segment starts with the size of its first chunk, followed by
+ * the chunks, each prefixed with the size of its block, all as 32-bit little
+ * endian integers.
+ */
+#define POLYGEN_COMPRESSED_DATA_CHUNK_SIZE 65536
+
+static size_t read_chunk_size(const uint8_t* data) {
+  return (size_t)data[0] | ((size_t)data[1] << 8) | ((size_t)data[2] << 16) |
+         ((size_t)data[3] << 24);
+}
+
+/*
+ * Decompresses chunks of a segment overlapping range [from, to) of its
+ * contents, into dst of specified capacity. Sets first_chunk to offset of the
+ * first decompressed chunk in the segment.
+ */
+static bool decompress_chunks(const uint8_t* data,
+                              size_t compressed_size,
+                              size_t size,
+                              size_t from,
+                              size_t to,
+                              uint8_t* dst,
+                              size_t capacity,
+                              size_t* first_chunk) {
+  const uint8_t* src_end = data + compressed_size;
+  if (compressed_size < 4 || to > size) {
+    return false;
+  }
+
+  size_t chunk_size = read_chunk_size(data);
+  const uint8_t* src = data + 4;
+  size_t chunk_start = 0;
+  size_t written = 0;
+  while (chunk_start < to) {
+    size_t chunk_length =
+        chunk_size < size - chunk_start ? chunk_size : size - chunk_start;
+    if (chunk_length == 0 || src_end - src < 4) {
+      return false;
+    }
+    size_t block_size = read_chunk_size(src);
+    src += 4;
+    if (block_size > (size_t)(src_end - src)) {
+      return false;
+    }
+
+    if (chunk_start + chunk_length > from) {
+      if (written == 0) {
+        *first_chunk = chunk_start;
+      }
+      if (chunk_length > capacity - written ||
+          !lz4_decompress(src, block_size, dst + written, chunk_length)) {
+        return false;
+      }
+      written += chunk_length;
+    }
+
+    src += block_size;
+    chunk_start += chunk_length;
+    chunk_size = POLYGEN_COMPRESSED_DATA_CHUNK_SIZE;
+  }
+
+  return true;
+}
+
+#if WASM_RT_USE_MMAP && defined(__linux__) && POLYGEN_USE_USERFAULTFD
+
+/*
+ * Experimental: large data segments that cannot be mapped from the binary,
+ * including compressed ones, are populated lazily when first touched, a
+ * WebAssembly page at a time, by a thread serving userfaultfd page faults.
+ * Instantiating modules then costs the same regardless of size of their data,
+ * and only pages actually used become resident.
+ *
+ * Only whole pages of a segment are populated lazily, the partial ones at its
+ * ends are written when instantiating, together with smaller segments. When
+ * unprivileged userfaultfd is disabled, only faults raised in user space are
+ * handled, so system calls accessing pages not touched before fail with EFAULT.
+ */
+struct lazy_segment {
+  uint8_t* base;
+  uint8_t* start;
+  uint8_t* end;
+  uint8_t* dest;
+  const uint8_t* data;
+  size_t compressed_size;
+  size_t size;
+};
+
+static int lazy_fd = -1;
+static pthread_once_t lazy_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t lazy_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct lazy_segment* lazy_segments = NULL;
+static size_t lazy_segment_count = 0;
+static size_t lazy_segment_capacity = 0;
+
+/* Decompressed chunks, used only by the fault handling thread */
+static uint8_t lazy_staging[2 * POLYGEN_COMPRESSED_DATA_CHUNK_SIZE];
+
+static void lazy_copy_pages(uint8_t* start, const uint8_t* src, size_t size) {
+  struct uffdio_copy copy = {
+      .dst = (uintptr_t)start, .src = (uintptr_t)src, .len = size, .mode = 0};
+  if (ioctl(lazy_fd, UFFDIO_COPY, &copy) == 0) {
+    return;
+  }
+
+  /* Some of the pages are populated already, fill the remaining ones */
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  for (size_t offset = 0; offset < size; offset += page_size) {
+    struct uffdio_copy page_copy = {.dst = (uintptr_t)(start + offset),
+                                    .src = (uintptr_t)(src + offset),
+                                    .len = page_size,
+                                    .mode = UFFDIO_COPY_MODE_DONTWAKE};
+    ioctl(lazy_fd, UFFDIO_COPY, &page_copy);
+  }
+  struct uffdio_range range = {.start = (uintptr_t)start, .len = size};
+  ioctl(lazy_fd, UFFDIO_WAKE, &range);
+}
+
+/*
+ * Populates the WebAssembly page containing the faulting address, with the
+ * latest segment covering it.
+ */
+static void lazy_handle_fault(uint8_t* addr) {
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  uint8_t* page = addr - (uintptr_t)addr % page_size;
+
+  pthread_mutex_lock(&lazy_lock);
+  size_t index = lazy_segment_count;
+  while (index > 0 && (addr < lazy_segments[index - 1].start ||
+                       addr >= lazy_segments[index - 1].end)) {
+    index--;
+  }
+  if (index == 0) {
+    /* Segment was removed, e.g. by freeing the memory while it was accessed */
+    struct uffdio_zeropage zero = {
+        .range = {.start = (uintptr_t)page, .len = page_size}, .mode = 0};
+    ioctl(lazy_fd, UFFDIO_ZEROPAGE, &zero);
+    pthread_mutex_unlock(&lazy_lock);
+    return;
+  }
+
+  const struct lazy_segment* segment = &lazy_segments[index - 1];
+  size_t wasm_page = (size_t)(page - segment->base) / WASM_PAGE_SIZE;
+  uint8_t* start = segment->base + wasm_page * WASM_PAGE_SIZE;
+  uint8_t* end = start + WASM_PAGE_SIZE;
+  start = start > segment->start ? start : segment->start;
+  end = end < segment->end ? end : segment->end;
+
+  /* Pages of segments registered later are populated with their contents */
+  for (size_t i = index; i < lazy_segment_count; i++) {
+    const struct lazy_segment* later = &lazy_segments[i];
+    if (later->start > addr && later->start < end) {
+      end = later->start;
+    }
+    if (later->end <= addr && later->end > start) {
+      start = later->end;
+    }
+  }
+
+  const uint8_t* src = segment->data + (start - segment->dest);
+  if (segment->compressed_size != 0) {
+    size_t first_chunk;
+    if (!decompress_chunks(segment->data, segment->compressed_size,
+                           segment->size, (size_t)(start - segment->dest),
+                           (size_t)(end - segment->dest), lazy_staging,
+                           sizeof(lazy_staging), &first_chunk)) {
+      fprintf(stderr, "Malformed compressed data segment\n");
+      abort();
+    }
+    src = lazy_staging + (size_t)(start - segment->dest) - first_chunk;
+  }
+
+  lazy_copy_pages(start, src, (size_t)(end - start));
+  pthread_mutex_unlock(&lazy_lock);
+}
+
+static void* lazy_handle_faults(void* arg) {
+  (void)arg;
+  for (;;) {
+    struct uffd_msg msg;
+    ssize_t ret = read(lazy_fd, &msg, sizeof(msg));
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret != sizeof(msg)) {
+      /* Threads waiting for their faults would never resume */
+      perror("userfaultfd read failed");
+      abort();
+    }
+    if (msg.event == UFFD_EVENT_PAGEFAULT) {
+      lazy_handle_fault((uint8_t*)(uintptr_t)msg.arg.pagefault.address);
+    }
+  }
+  return NULL;
+}
+
+static void lazy_init(void) {
+  int fd = (int)syscall(SYS_userfaultfd, O_CLOEXEC);
+#ifdef UFFD_USER_MODE_ONLY
+  if (fd < 0) {
+    fd = (int)syscall(SYS_userfaultfd, O_CLOEXEC | UFFD_USER_MODE_ONLY);
+  }
+#endif
+  if (fd < 0) {
+    return;
+  }
+
+  struct uffdio_api api = {.api = UFFD_API, .features = 0};
+  if (ioctl(fd, UFFDIO_API, &api) != 0) {
+    close(fd);
+    return;
+  }
+
+  lazy_fd = fd;
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, lazy_handle_faults, NULL) != 0) {
+    lazy_fd = -1;
+    close(fd);
+    return;
+  }
+  pthread_detach(thread);
+}
+
+static bool lazy_add_segment(const struct lazy_segment* segment) {
+  bool added = true;
+  pthread_mutex_lock(&lazy_lock);
+  if (lazy_segment_count == lazy_segment_capacity) {
+    size_t capacity = lazy_segment_capacity ? lazy_segment_capacity * 2 : 4;
+    struct lazy_segment* segments =
+        realloc(lazy_segments, capacity * sizeof(struct lazy_segment));
+    if (segments) {
+      lazy_segments = segments;
+      lazy_segment_capacity = capacity;
+    } else {
+      added = false;
+    }
+  }
+  if (added) {
+    lazy_segments[lazy_segment_count++] = *segment;
+  }
+  pthread_mutex_unlock(&lazy_lock);
+  return added;
+}
+
+/*
+ * Unregisters lazily populated segments of a freed memory.
+ */
+static void os_take_lazy(void* addr) {
+  pthread_mutex_lock(&lazy_lock);
+  size_t kept = 0;
+  for (size_t i = 0; i < lazy_segment_count; i++) {
+    const struct lazy_segment* segment = &lazy_segments[i];
+    if (segment->base != addr) {
+      lazy_segments[kept++] = *segment;
+      continue;
+    }
+    struct uffdio_range range = {.start = (uintptr_t)segment->start,
+                                 .len = (size_t)(segment->end - segment->start)};
+    ioctl(lazy_fd, UFFDIO_UNREGISTER, &range);
+  }
+  lazy_segment_count = kept;
+  pthread_mutex_unlock(&lazy_lock);
+}
+
+/*
+ * Registers whole pages of a segment to be populated lazily, and writes its
+ * partial pages. Returns false if the segment must be written in full instead.
+ */
+static bool os_load_lazy(wasm_rt_memory_t* memory,
+                         uint64_t offset,
+                         const uint8_t* data,
+                         size_t compressed_size,
+                         size_t size) {
+  pthread_once(&lazy_once, lazy_init);
+  if (lazy_fd < 0) {
+    return false;
+  }
+
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  uint8_t* dest = memory->data + offset;
+  size_t head = (page_size - (uintptr_t)dest % page_size) % page_size;
+  if (size < head + page_size) {
+    return false;
+  }
+  size_t lazy_size = (size - head) / page_size * page_size;
+  struct lazy_segment segment = {.base = memory->data,
+                                 .start = dest + head,
+                                 .end = dest + head + lazy_size,
+                                 .dest = dest,
+                                 .data = data,
+                                 .compressed_size = compressed_size,
+                                 .size = size};
+
+  /*
+   * Partial pages are written first, so that a segment which fails to decompress
+   * is never registered. Chunks are only aligned to pages when the segment offset
+   * is constant, so a partial page may span two chunks.
+   */
+  size_t tail = size - head - lazy_size;
+  if (compressed_size == 0) {
+    memcpy(dest, data, head);
+    memcpy(segment.end, data + head + lazy_size, tail);
+  } else {
+    const size_t capacity = 2 * POLYGEN_COMPRESSED_DATA_CHUNK_SIZE;
+    uint8_t* buffer = malloc(capacity);
+    size_t first_chunk;
+    bool decompressed =
+        buffer && decompress_chunks(data, compressed_size, size, 0, head,
+                                    buffer, capacity, &first_chunk);
+    if (decompressed) {
+      memcpy(dest, buffer, head);
+      decompressed = decompress_chunks(data, compressed_size, size, size - tail,
+                                       size, buffer, capacity, &first_chunk);
+    }
+    if (decompressed) {
+      memcpy(segment.end, buffer + (size - tail - first_chunk), tail);
+    }
+    free(buffer);
+    if (!decompressed) {
+      /* Decompressed eagerly instead, which reports malformed data */
+      return false;
+    }
+  }
+
+  /* Pages written before would not fault, drop them as they are overwritten anyway */
+  if (madvise(segment.start, lazy_size, MADV_DONTNEED) != 0) {
+    return false;
+  }
+
+  struct uffdio_register registration = {
+      .range = {.start = (uintptr_t)segment.start, .len = lazy_size},
+      .mode = UFFDIO_REGISTER_MODE_MISSING};
+  if (ioctl(lazy_fd, UFFDIO_REGISTER, &registration) != 0) {
+    return false;
+  }
+  if (!lazy_add_segment(&segment)) {
+    ioctl(lazy_fd, UFFDIO_UNREGISTER, &registration.range);
+    return false;
+  }
+  return true;
+}
+
+#else
+
+static inline void os_take_lazy(void* addr) {
+  (void)addr;
+}
+
+static inline bool os_load_lazy(wasm_rt_memory_t* memory,
+                         uint64_t offset,
+                         const uint8_t* data,
+                         size_t compressed_size,
+                         size_t size) {
+  (void)memory;
+  (void)offset;
+  (void)data;
+  (void)compressed_size;
+  (void)size;
+  return false;
+}
+
+#endif
+
 #if WASM_RT_USE_MMAP
 
 #ifdef _WIN32
@@ -112,8 +619,60 @@ static void os_print_last_error(const char* msg) {
   }
 }
 
+static int os_release(void* addr, size_t size, size_t used_size) {
+  (void)used_size; /* unused */
+  return os_munmap(addr, size);
+}
+
 #else
+
+/*
+ * Reservations of freed memories, reused by following allocations of the same
+ * size. Reusing a reservation costs a couple of system calls, instead of mapping
+ * a new one and unmapping the old one, which makes re-instantiating modules cheap.
+ */
+#ifndef WASM_RT_RECYCLED_MEMORY_COUNT
+#define WASM_RT_RECYCLED_MEMORY_COUNT 4
+#endif
+
+/* Maximum size of resident pages of a recycled memory cleared in place. */
+#ifndef WASM_RT_RECYCLED_MEMORY_RESIDENT_LIMIT
+#define WASM_RT_RECYCLED_MEMORY_RESIDENT_LIMIT (2 * 1024 * 1024)
+#endif
+
+static struct {
+  void* addr;
+  size_t size;
+} recycled_memories[WASM_RT_RECYCLED_MEMORY_COUNT];
+static size_t recycled_memory_count = 0;
+static pthread_mutex_t recycled_memory_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Takes the oldest recycled reservation of the specified size, so that memories
+ * freed and allocated in the same order, e.g. when resetting an instance, keep
+ * their addresses.
+ */
+static void* os_take_recycled(size_t size) {
+  void* addr = NULL;
+  pthread_mutex_lock(&recycled_memory_lock);
+  for (size_t i = 0; i < recycled_memory_count; i++) {
+    if (recycled_memories[i].size == size) {
+      addr = recycled_memories[i].addr;
+      recycled_memory_count--;
+      memmove(&recycled_memories[i], &recycled_memories[i + 1],
+              (recycled_memory_count - i) * sizeof(recycled_memories[0]));
+      break;
+    }
+  }
+  pthread_mutex_unlock(&recycled_memory_lock);
+  return addr;
+}
+
 static void* os_mmap(size_t size) {
+    void* recycled = os_take_recycled(size);
+    if (recycled)
+        return recycled;
+
     int map_prot = PROT_NONE;
     int map_flags = MAP_ANONYMOUS | MAP_PRIVATE;
     uint8_t* addr = mmap(NULL, size, map_prot, map_flags, -1, 0);
@@ -126,6 +685,181 @@ static int os_munmap(void* addr, size_t size) {
     return munmap(addr, size);
 }
 
+/*
+ * Replaces pages in the specified range with new inaccessible ones.
+ */
+static int os_replace_pages(void* addr, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  void* ret = mmap(addr, size, PROT_NONE,
+                   MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED, -1, 0);
+  return ret == addr ? 0 : -1;
+}
+
+/*
+ * Drops pages in the specified range, so that they read as zeroes when touched again.
+ */
+static int os_drop_pages(void* addr, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+#ifdef __linux__
+  return madvise(addr, size, MADV_DONTNEED);
+#else
+  /* MADV_DONTNEED does not zero pages on Darwin, replace them instead */
+  return os_replace_pages(addr, size);
+#endif
+}
+
+/*
+ * Clears pages used by a freed memory, so that they read as zeroes when the
+ * reservation is reused, and makes them inaccessible for bounds checks.
+ *
+ * When only a few pages are resident, they are cleared in place, as faulting
+ * them in again would cost more than clearing them. Pages that are not
+ * resident, e.g. never touched or swapped out, are always dropped.
+ */
+static int os_discard(void* addr, size_t used_size) {
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  const size_t page_count = used_size / page_size;
+  uint8_t* base = (uint8_t*)addr;
+
+  size_t resident_count = 0;
+  unsigned char residency[1024];
+  for (size_t first = 0; first < page_count; first += sizeof(residency)) {
+    size_t count = page_count - first < sizeof(residency)
+                       ? page_count - first
+                       : sizeof(residency);
+    if (mincore(base + first * page_size, count * page_size,
+                (void*)residency) != 0) {
+      return -1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      resident_count += residency[i] & 1;
+    }
+  }
+
+  if (resident_count * page_size > WASM_RT_RECYCLED_MEMORY_RESIDENT_LIMIT) {
+    if (os_drop_pages(addr, used_size) != 0) {
+      return -1;
+    }
+    return mprotect(addr, used_size, PROT_NONE);
+  }
+
+  for (size_t first = 0; first < page_count; first += sizeof(residency)) {
+    size_t count = page_count - first < sizeof(residency)
+                       ? page_count - first
+                       : sizeof(residency);
+    uint8_t* chunk = base + first * page_size;
+    if (mincore(chunk, count * page_size, (void*)residency) != 0) {
+      return -1;
+    }
+
+    size_t run_start = 0;
+    for (size_t i = 0; i <= count; i++) {
+      bool is_resident = i < count && (residency[i] & 1);
+      if (is_resident) {
+        memset(chunk + i * page_size, 0, page_size);
+      }
+      if (i == count || is_resident) {
+        if (os_drop_pages(chunk + run_start * page_size,
+                          (i - run_start) * page_size) != 0) {
+          return -1;
+        }
+        run_start = i + 1;
+      }
+    }
+  }
+
+  return mprotect(addr, used_size, PROT_NONE);
+}
+
+/*
+ * Reservations with pages mapped from a file. Dropping such pages would bring
+ * back contents of the file, so they are replaced when the memory is freed.
+ */
+static void** file_mapped_memories = NULL;
+static size_t file_mapped_memory_count = 0;
+static size_t file_mapped_memory_capacity = 0;
+
+static bool os_add_file_mapped(void* addr) {
+  bool added = true;
+  pthread_mutex_lock(&recycled_memory_lock);
+  for (size_t i = 0; i < file_mapped_memory_count; i++) {
+    if (file_mapped_memories[i] == addr) {
+      pthread_mutex_unlock(&recycled_memory_lock);
+      return true;
+    }
+  }
+  if (file_mapped_memory_count == file_mapped_memory_capacity) {
+    size_t capacity = file_mapped_memory_capacity ? file_mapped_memory_capacity * 2 : 4;
+    void** memories = realloc(file_mapped_memories, capacity * sizeof(void*));
+    if (memories) {
+      file_mapped_memories = memories;
+      file_mapped_memory_capacity = capacity;
+    } else {
+      added = false;
+    }
+  }
+  if (added) {
+    file_mapped_memories[file_mapped_memory_count++] = addr;
+  }
+  pthread_mutex_unlock(&recycled_memory_lock);
+  return added;
+}
+
+/*
+ * Removes the reservation from file mapped ones, returning true if it was one.
+ */
+static bool os_take_file_mapped(void* addr) {
+  bool found = false;
+  pthread_mutex_lock(&recycled_memory_lock);
+  for (size_t i = 0; i < file_mapped_memory_count; i++) {
+    if (file_mapped_memories[i] == addr) {
+      file_mapped_memories[i] = file_mapped_memories[--file_mapped_memory_count];
+      found = true;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&recycled_memory_lock);
+  return found;
+}
+
+/*
+ * Releases reservation of a freed memory, keeping it for reuse if possible.
+ */
+static int os_release(void* addr, size_t size, size_t used_size) {
+  os_take_lazy(addr);
+  bool is_file_mapped = os_take_file_mapped(addr);
+
+  pthread_mutex_lock(&recycled_memory_lock);
+  bool has_room = recycled_memory_count < WASM_RT_RECYCLED_MEMORY_COUNT;
+  pthread_mutex_unlock(&recycled_memory_lock);
+
+  if (!has_room) {
+    return os_munmap(addr, size);
+  }
+
+  int discarded = is_file_mapped ? os_replace_pages(addr, used_size)
+                                 : os_discard(addr, used_size);
+  if (discarded != 0) {
+    return os_munmap(addr, size);
+  }
+
+  pthread_mutex_lock(&recycled_memory_lock);
+  if (recycled_memory_count < WASM_RT_RECYCLED_MEMORY_COUNT) {
+    recycled_memories[recycled_memory_count].addr = addr;
+    recycled_memories[recycled_memory_count].size = size;
+    recycled_memory_count++;
+    addr = NULL;
+  }
+  pthread_mutex_unlock(&recycled_memory_lock);
+
+  return addr ? os_munmap(addr, size) : 0;
+}
+
 static int os_mprotect(void* addr, size_t size) {
     return mprotect(addr, size, PROT_READ | PROT_WRITE);
 }
@@ -156,6 +890,268 @@ static uint64_t get_alloc_size_for_mmap(uint64_t max_pages, bool is64) {
 
 #endif
 
+#if WASM_RT_USE_MMAP && !defined(_WIN32)
+
+bool polygen_map_memory_from_file(wasm_rt_memory_t* memory,
+                                  int fd,
+                                  uint64_t offset,
+                                  uint64_t size) {
+  if (size > memory->size) {
+    return false;
+  }
+  if (size == 0) {
+    return true;
+  }
+  /* Registered first, so that file pages are replaced when the memory is freed */
+  if (!os_add_file_mapped(memory->data)) {
+    return false;
+  }
+  void* addr = mmap(memory->data, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_FIXED, fd, (off_t)offset);
+  return addr == (void*)memory->data;
+}
+
+/*
+ * Maps new pages after a failed attempt to map data, which may have replaced
+ * the pages in the specified range.
+ */
+static void os_restore_data_pages(void* addr, size_t size) {
+  void* ret = mmap(addr, size, PROT_READ | PROT_WRITE,
+                   MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED, -1, 0);
+  if (ret != addr) {
+    os_print_last_error("os_mmap failed.");
+    abort();
+  }
+}
+
+#ifdef __APPLE__
+
+/*
+ * Maps pages of data from the binary at the specified address, as private
+ * copy-on-write pages.
+ */
+static int os_map_data(void* addr, const void* data, size_t size) {
+  vm_address_t target = (vm_address_t)addr;
+  vm_prot_t cur_protection, max_protection;
+  kern_return_t ret =
+      vm_remap(mach_task_self(), &target, size, 0,
+               VM_FLAGS_FIXED | VM_FLAGS_OVERWRITE, mach_task_self(),
+               (vm_address_t)data, TRUE, &cur_protection, &max_protection,
+               VM_INHERIT_NONE);
+  if (ret != KERN_SUCCESS || target != (vm_address_t)addr ||
+      mprotect(addr, size, PROT_READ | PROT_WRITE) != 0) {
+    os_restore_data_pages(addr, size);
+    return -1;
+  }
+  return 0;
+}
+
+#else
+
+/*
+ * File mappings of the binary holding data segments, found in /proc/self/maps.
+ */
+struct data_source {
+  uintptr_t start;
+  uintptr_t end;
+  uint64_t offset;
+  int fd;
+};
+
+static struct data_source* data_sources = NULL;
+static size_t data_source_count = 0;
+static size_t data_source_capacity = 0;
+
+static bool os_find_cached_data_source(const void* data,
+                                       struct data_source* source) {
+  bool found = false;
+  pthread_mutex_lock(&recycled_memory_lock);
+  for (size_t i = 0; i < data_source_count; i++) {
+    if ((uintptr_t)data >= data_sources[i].start &&
+        (uintptr_t)data < data_sources[i].end) {
+      *source = data_sources[i];
+      found = true;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&recycled_memory_lock);
+  return found;
+}
+
+static bool os_cache_data_source(const struct data_source* source) {
+  bool added = true;
+  pthread_mutex_lock(&recycled_memory_lock);
+  if (data_source_count == data_source_capacity) {
+    size_t capacity = data_source_capacity ? data_source_capacity * 2 : 4;
+    struct data_source* sources =
+        realloc(data_sources, capacity * sizeof(struct data_source));
+    if (sources) {
+      data_sources = sources;
+      data_source_capacity = capacity;
+    } else {
+      added = false;
+    }
+  }
+  if (added) {
+    data_sources[data_source_count++] = *source;
+  }
+  pthread_mutex_unlock(&recycled_memory_lock);
+  return added;
+}
+
+static bool os_find_data_source(const void* data, struct data_source* source) {
+  if (os_find_cached_data_source(data, source)) {
+    return true;
+  }
+
+  FILE* maps = fopen("/proc/self/maps", "re");
+  if (!maps) {
+    return false;
+  }
+
+  bool found = false;
+  char line[4096 + 128];
+  while (fgets(line, sizeof(line), maps)) {
+    unsigned long start, end, offset;
+    int path_start = 0;
+    if (sscanf(line, "%lx-%lx %*s %lx %*s %*s %n", &start, &end, &offset,
+               &path_start) < 3 ||
+        (uintptr_t)data < start || (uintptr_t)data >= end) {
+      continue;
+    }
+
+    char* path = line + path_start;
+    path[strcspn(path, "\n")] = '\0';
+    if (path_start > 0 && path[0] == '/') {
+      source->start = start;
+      source->end = end;
+      source->offset = offset;
+      source->fd = open(path, O_RDONLY | O_CLOEXEC);
+      found = source->fd >= 0;
+    }
+    break;
+  }
+  fclose(maps);
+
+  if (found && !os_cache_data_source(source)) {
+    close(source->fd);
+    found = false;
+  }
+  return found;
+}
+
+/*
+ * Maps pages of data from the binary at the specified address, as private
+ * copy-on-write pages of the file the binary was loaded from.
+ */
+static int os_map_data(void* addr, const void* data, size_t size) {
+  struct data_source source;
+  if (!os_find_data_source(data, &source) ||
+      (uintptr_t)data + size > source.end) {
+    return -1;
+  }
+
+  /* Checks that the file still holds the data, e.g. it was not replaced */
+  uint64_t offset = source.offset + ((uintptr_t)data - source.start);
+  uint8_t head[64], tail[64];
+  if (pread(source.fd, head, sizeof(head), (off_t)offset) != sizeof(head) ||
+      pread(source.fd, tail, sizeof(tail),
+            (off_t)(offset + size - sizeof(tail))) != sizeof(tail) ||
+      memcmp(head, data, sizeof(head)) != 0 ||
+      memcmp(tail, (const uint8_t*)data + size - sizeof(tail),
+             sizeof(tail)) != 0) {
+    return -1;
+  }
+
+  void* ret = mmap(addr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                   source.fd, (off_t)offset);
+  if (ret != addr) {
+    os_restore_data_pages(addr, size);
+    return -1;
+  }
+  return 0;
+}
+
+#endif
+
+void polygen_load_mapped_data(wasm_rt_memory_t* memory,
+                              uint64_t offset,
+                              const uint8_t* data,
+                              size_t size) {
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  uint8_t* dest = memory->data + offset;
+  size_t head = (page_size - (uintptr_t)dest % page_size) % page_size;
+  size_t mapped_size = size > head ? (size - head) / page_size * page_size : 0;
+
+  /* Only whole pages congruent with their destination can be mapped */
+  bool is_mapped = mapped_size != 0 &&
+                   ((uintptr_t)dest - (uintptr_t)data) % page_size == 0 &&
+                   os_add_file_mapped(memory->data) &&
+                   os_map_data(dest + head, data + head, mapped_size) == 0;
+  if (!is_mapped) {
+    if (!os_load_lazy(memory, offset, data, 0, size)) {
+      memcpy(dest, data, size);
+    }
+    return;
+  }
+
+  memcpy(dest, data, head);
+  memcpy(dest + head + mapped_size, data + head + mapped_size,
+         size - head - mapped_size);
+}
+
+#else
+
+bool polygen_map_memory_from_file(wasm_rt_memory_t* memory,
+                                  int fd,
+                                  uint64_t offset,
+                                  uint64_t size) {
+  if (size > memory->size) {
+    return false;
+  }
+#ifdef _WIN32
+  (void)fd;
+  (void)offset;
+  return false;
+#else
+  uint64_t read_size = 0;
+  while (read_size < size) {
+    ssize_t ret = pread(fd, memory->data + read_size, size - read_size,
+                        (off_t)(offset + read_size));
+    if (ret <= 0) {
+      return false;
+    }
+    read_size += (uint64_t)ret;
+  }
+  return true;
+#endif
+}
+
+void polygen_load_mapped_data(wasm_rt_memory_t* memory,
+                              uint64_t offset,
+                              const uint8_t* data,
+                              size_t size) {
+  memcpy(memory->data + offset, data, size);
+}
+
+#endif
+
+void polygen_load_compressed_data(wasm_rt_memory_t* memory,
+                                  uint64_t offset,
+                                  const uint8_t* data,
+                                  size_t compressed_size,
+                                  size_t size) {
+  if (os_load_lazy(memory, offset, data, compressed_size, size)) {
+    return;
+  }
+
+  size_t first_chunk;
+  if (!decompress_chunks(data, compressed_size, size, 0, size,
+                         memory->data + offset, size, &first_chunk)) {
+    wasm_rt_trap(WASM_RT_TRAP_OOB);
+  }
+}
+
 // Include operations for memory
 #define WASM_RT_MEM_OPS
 #include "wasm-rt-mem-impl-helper.inc"
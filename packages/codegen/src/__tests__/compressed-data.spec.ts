@@ -0,0 +1,121 @@
+import { execFileSync, spawnSync } from 'node:child_process';
+import { mkdtempSync, rmSync } from 'node:fs';
+import { tmpdir } from 'node:os';
+import path from 'node:path';
+import { fileURLToPath } from 'node:url';
+import { afterAll, beforeAll, describe, expect, it } from 'vitest';
+import {
+  COMPRESSED_DATA_CHUNK_SIZE,
+  compressChunks,
+} from '../wasm2c/compressed-data.js';
+
+const TESTS_DIRECTORY = path.dirname(fileURLToPath(import.meta.url));
+const WASM_RT_DIRECTORY = path.resolve(TESTS_DIRECTORY, '../../assets/wasm-rt');
+const COMPILER = process.env.CC ?? 'cc';
+
+const hasCompiler = spawnSync(COMPILER, ['--version']).status === 0;
+
+/**
+ * Returns text made of words picked from a small vocabulary by a fixed
+ * sequence.
+ */
+function makeText(size: number): Uint8Array {
+  const words = ['memory', 'table', 'global', 'module', 'export', 'import'];
+  const data = new Uint8Array(size);
+  let state = 1;
+  for (let i = 0; i < size; ) {
+    state = (Math.imul(state, 1103515245) + 12345) >>> 0;
+    for (const char of `${words[state % words.length]} `) {
+      if (i < size) {
+        data[i++] = char.charCodeAt(0);
+      }
+    }
+  }
+  return data;
+}
+
+/**
+ * Returns bytes of a fixed pseudo-random sequence, which do not compress.
+ */
+function makeRandom(size: number): Uint8Array {
+  const data = new Uint8Array(size);
+  let state = 1;
+  for (let i = 0; i < size; i++) {
+    state = (Math.imul(state, 1103515245) + 12345) >>> 0;
+    data[i] = state >>> 24;
+  }
+  return data;
+}
+
+const SIZES: [string, number][] = [
+  ['empty', 0],
+  ['smaller than a chunk', 1000],
+  ['exactly a chunk', COMPRESSED_DATA_CHUNK_SIZE],
+  ['spanning multiple chunks', 3 * COMPRESSED_DATA_CHUNK_SIZE + 4321],
+];
+
+const KINDS: [string, (size: number) => Uint8Array][] = [
+  ['text', makeText],
+  ['zeros', (size) => new Uint8Array(size)],
+  ['random bytes', makeRandom],
+];
+
+describe('compressChunks', () => {
+  it('should start with size of the first chunk', () => {
+    const compressed = compressChunks(makeText(1000), 1000);
+    const view = new DataView(compressed.buffer, compressed.byteOffset);
+    expect(view.getUint32(0, true)).toBe(COMPRESSED_DATA_CHUNK_SIZE - 1000);
+  });
+});
+
+// Segments are decoded by the runtime, built from `assets/wasm-rt` by the C
+// compiler
+describe.skipIf(!hasCompiler)('decompressing with the runtime', () => {
+  let directory: string;
+  let decompressor: string;
+
+  beforeAll(() => {
+    directory = mkdtempSync(path.join(tmpdir(), 'polygen-compressed-data-'));
+    decompressor = path.join(directory, 'decompress-chunks');
+    execFileSync(COMPILER, [
+      '-O1',
+      `-I${WASM_RT_DIRECTORY}`,
+      path.join(TESTS_DIRECTORY, 'decompress-chunks.c'),
+      path.join(WASM_RT_DIRECTORY, 'wasm-rt-impl.c'),
+      path.join(WASM_RT_DIRECTORY, 'wasm-rt-mem-impl.c'),
+      path.join(WASM_RT_DIRECTORY, 'wasm-rt-exceptions.c'),
+      '-lpthread',
+      '-o',
+      decompressor,
+    ]);
+  }, 60_000);
+
+  afterAll(() => {
+    if (directory) {
+      rmSync(directory, { recursive: true, force: true });
+    }
+  });
+
+  function decompress(compressed: Uint8Array, offset: number, size: number) {
+    const output = execFileSync(decompressor, [String(offset), String(size)], {
+      input: compressed,
+      maxBuffer: size + 1024,
+    });
+    return new Uint8Array(output);
+  }
+
+  // Offset of segments which is not constant is only known when instantiating
+  describe.each([
+    ['at constant offset aligned to a chunk', 0, 0],
+    ['at constant offset', 1000, 1000],
+    ['at offset known when instantiating', undefined, 3000],
+  ])('%s', (_, constantOffset, offset) => {
+    for (const [kind, makeData] of KINDS) {
+      it.each(SIZES)(`should restore ${kind} %s`, (__, size) => {
+        const data = makeData(size);
+        const compressed = compressChunks(data, constantOffset);
+        expect(decompress(compressed, offset, size)).toEqual(data);
+      });
+    }
+  });
+});
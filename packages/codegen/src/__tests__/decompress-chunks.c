@@ -0,0 +1,55 @@
+/*
+ * Loads a data segment compressed by `compressChunks()` into a WebAssembly
+ * memory with `polygen_load_compressed_data()`, as generated modules do, and
+ * writes the segment back to the standard output. Used by
+ * `compressed-data.spec.ts` to decode with the runtime shipped in `assets`.
+ *
+ * Usage: decompress-chunks <offset> <size> < compressed
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "wasm-rt.h"
+
+void polygen_load_compressed_data(wasm_rt_memory_t* memory,
+                                  uint64_t offset,
+                                  const uint8_t* data,
+                                  size_t compressed_size,
+                                  size_t size);
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <offset> <size> < compressed\n", argv[0]);
+    return 2;
+  }
+  uint64_t offset = strtoull(argv[1], NULL, 10);
+  size_t size = (size_t)strtoull(argv[2], NULL, 10);
+
+  size_t capacity = 65536;
+  size_t compressed_size = 0;
+  uint8_t* data = malloc(capacity);
+  for (size_t read; data && (read = fread(data + compressed_size, 1,
+                                          capacity - compressed_size, stdin));) {
+    compressed_size += read;
+    if (compressed_size == capacity) {
+      capacity *= 2;
+      data = realloc(data, capacity);
+    }
+  }
+  if (!data) {
+    fprintf(stderr, "Out of memory\n");
+    return 1;
+  }
+
+  wasm_rt_init();
+  uint64_t pages = (offset + size) / 65536 + 1;
+  wasm_rt_memory_t memory;
+  wasm_rt_allocate_memory(&memory, pages, pages, false);
+  polygen_load_compressed_data(&memory, offset, data, compressed_size, size);
+  fwrite(memory.data + offset, 1, size, stdout);
+
+  wasm_rt_free_memory(&memory);
+  wasm_rt_free();
+  free(data);
+  return 0;
+}
@@ -0,0 +1,50 @@
+import { describe, expect, it } from 'vitest';
+import {
+  computeModuleFingerprint,
+  fingerprintToBytes,
+} from '../helpers/fingerprint.js';
+import { makeModule } from './fixtures.js';
+
+// The runtime must compute the same fingerprints, the same vectors are
+// checked against it by `hash-parity` in `packages/polygen/benchmarks`
+describe('computeModuleFingerprint', () => {
+  it('should hash whole contents of a small module', () => {
+    expect(computeModuleFingerprint(makeModule(100))).toEqual({
+      size: 116,
+      contentHash: 0xf33d2dbbdc9daf7bn,
+      layoutHash: 0xe03390663ce24aacn,
+    });
+  });
+
+  it('should hash sampled blocks of a large module', () => {
+    expect(computeModuleFingerprint(makeModule(100000))).toEqual({
+      size: 100018,
+      contentHash: 0xdc11d5f8fdcfbf1fn,
+      layoutHash: 0x31113a6cb0c1ce50n,
+    });
+  });
+
+  it('should reject data without WebAssembly preamble', () => {
+    expect(() => computeModuleFingerprint(new Uint8Array(16))).toThrow();
+  });
+
+  it('should reject section exceeding module size', () => {
+    const module = makeModule(100);
+    expect(() => computeModuleFingerprint(module.subarray(0, 50))).toThrow();
+  });
+});
+
+describe('fingerprintToBytes', () => {
+  it('should serialize fields as little endian 64-bit integers', () => {
+    const bytes = fingerprintToBytes({
+      size: 0x0102,
+      contentHash: 0x1112131415161718n,
+      layoutHash: 0x2122232425262728n,
+    });
+
+    expect(Array.from(bytes)).toEqual([
+      0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x17, 0x16, 0x15,
+      0x14, 0x13, 0x12, 0x11, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21,
+    ]);
+  });
+});
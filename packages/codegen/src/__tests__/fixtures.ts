@@ -0,0 +1,34 @@
+/**
+ * Returns bytes following a fixed pattern, the same as `makeData()` in
+ * `packages/polygen/benchmarks/hash-parity.cpp`.
+ */
+export function makeData(length: number): Uint8Array {
+  return Uint8Array.from({ length }, (_, i) => (i * 131 + 17) % 251);
+}
+
+/**
+ * Returns a WebAssembly module made of a type section and a code section of
+ * specified size, filled by {@link makeData}. Contents of the sections are not
+ * valid, only their layout matters.
+ */
+export function makeModule(codeSize: number): Uint8Array {
+  const header = [0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00];
+  const typeSection = [0x01, 0x04, 0x01, 0x60, 0x00, 0x00];
+  const codeSectionHeader = [0x0a];
+  for (let value = codeSize; ; ) {
+    const byte = value & 0x7f;
+    value >>>= 7;
+    if (value === 0) {
+      codeSectionHeader.push(byte);
+      break;
+    }
+    codeSectionHeader.push(byte | 0x80);
+  }
+
+  return Uint8Array.from([
+    ...header,
+    ...typeSection,
+    ...codeSectionHeader,
+    ...makeData(codeSize),
+  ]);
+}
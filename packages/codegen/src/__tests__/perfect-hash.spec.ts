@@ -0,0 +1,34 @@
+import { describe, expect, it } from 'vitest';
+import { buildPerfectHashTable, hashKey } from '../helpers/perfect-hash.js';
+import { makeData } from './fixtures.js';
+
+// The runtime must compute the same hashes, the same vectors are checked
+// against `hashModuleBagKey()` by `hash-parity` in the native benchmarks
+describe('hashKey', () => {
+  const name = new TextEncoder().encode('example.wasm');
+
+  it.each([
+    [0, 0x15006435],
+    [7, 0x2fc38816],
+    [0xffffffff, 0x28dbb09e],
+  ])('should hash name with seed %i', (seed, expected) => {
+    expect(hashKey(name, seed)).toBe(expected);
+  });
+
+  it('should hash binary key', () => {
+    expect(hashKey(makeData(24), 123456789)).toBe(0x41556a2e);
+  });
+});
+
+describe('buildPerfectHashTable', () => {
+  it('should map every key to a distinct slot', () => {
+    const keys = Array.from({ length: 50 }, (_, i) =>
+      new TextEncoder().encode(`module-${i}.wasm`)
+    );
+    const { seed, slots } = buildPerfectHashTable(keys);
+
+    keys.forEach((key, index) => {
+      expect(slots[hashKey(key, seed) & (slots.length - 1)]).toBe(index + 1);
+    });
+  });
+});
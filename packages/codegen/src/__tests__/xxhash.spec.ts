@@ -0,0 +1,29 @@
+import { describe, expect, it } from 'vitest';
+import { xxh3 } from '../helpers/xxhash.js';
+import { makeData } from './fixtures.js';
+
+// The runtime must compute the same hashes, the same vectors are checked
+// against it by `hash-parity` in `packages/polygen/benchmarks`
+const VECTORS: [number, bigint][] = [
+  [0, 0x2d06800538d394c2n],
+  [1, 0xf319fe2bdfcdfebdn],
+  [3, 0x783f5bb022906e8dn],
+  [4, 0xecb6b53c1ccb45edn],
+  [8, 0x44979e978879e887n],
+  [9, 0x1563c8b0d01c5705n],
+  [16, 0x85915bb3d4afef90n],
+  [17, 0x9810c9a1e38ac419n],
+  [64, 0x941cf66ec32627e0n],
+  [128, 0xd19b9ef5e7ffe94bn],
+  [129, 0x9c1c3a7f14430ab5n],
+  [240, 0x84c8f5b8b2191a69n],
+  [241, 0xccf4c89522b37f0an],
+  [1024, 0xfcc808dc4130319cn],
+  [10000, 0xe21d547561c7f141n],
+];
+
+describe('xxh3', () => {
+  it.each(VECTORS)('should hash %i bytes', (length, expected) => {
+    expect(xxh3(makeData(length))).toBe(expected);
+  });
+});
@@ -2,6 +2,7 @@ import fs from 'node:fs/promises';
 import type { ResolvedModule } from '@callstack/polygen-project';
 import { Module } from '@callstack/wasm-parser';
 import { computeChecksumBuffer } from '../helpers/checksum.js';
+import { computeModuleFingerprint } from '../helpers/fingerprint.js';
 import { W2CExternModule, W2CGeneratedModule } from './modules.js';
 import type { ResolvedModuleImport } from './types.js';
 import { buildGeneratedSymbol } from './utils.js';
@@ -40,6 +41,7 @@ export class CodegenContext {
       encoding: null,
     });
     const checksum = computeChecksumBuffer(moduleContents.buffer);
+    const fingerprint = computeModuleFingerprint(moduleContents);
     const moduleBody = new Module(moduleContents.buffer as ArrayBuffer);
     const importedModules = this.processImportedModules(moduleBody);
 
@@ -47,6 +49,7 @@ export class CodegenContext {
       this,
       moduleBody,
       checksum,
+      fingerprint,
       module.resolvedPath,
       module
     );
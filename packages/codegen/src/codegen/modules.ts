@@ -1,6 +1,7 @@
 import path from 'node:path';
 import type { PolygenModuleConfig } from '@callstack/polygen-config';
 import type { Module, ModuleMemory, ModuleTable } from '@callstack/wasm-parser';
+import type { ModuleFingerprint } from '../helpers/fingerprint.js';
 import { mangleModuleName } from '../wasm2c/mangle.js';
 import type { CodegenContext } from './context.js';
 import type {
@@ -98,6 +99,11 @@ export class W2CGeneratedModule extends W2CModuleBase {
    * SHA-256 checksum of module contents
    */
   public readonly checksum: Buffer;
+
+  /**
+   * Fingerprint of module contents, used by the runtime to find the module by its contents
+   */
+  public readonly fingerprint: ModuleFingerprint;
   public readonly generatedClassName: string;
 
   /**
@@ -120,10 +126,16 @@ export class W2CGeneratedModule extends W2CModuleBase {
    */
   public readonly exports: GeneratedSymbol[];
 
+  /**
+   * Configuration of this module.
+   */
+  public readonly config: PolygenModuleConfig;
+
   constructor(
     context: CodegenContext,
     body: Module,
     checksum: Buffer,
+    fingerprint: ModuleFingerprint,
     sourceModulePath: string,
     moduleSpec: PolygenModuleConfig
   ) {
@@ -135,9 +147,11 @@ export class W2CGeneratedModule extends W2CModuleBase {
     this.sourceModulePath = sourceModulePath;
     this.generatedClassName = capitalize(mangleModuleName(name));
     this.checksum = checksum;
+    this.fingerprint = fingerprint;
     this.moduleImports = processImportedModulesInfo(this.body, context);
     this.imports = resolveImports(context, this.body);
     this.exports = processExports(this, this.body);
+    this.config = moduleSpec;
   }
 
   /**
@@ -177,6 +191,36 @@ export class W2CGeneratedModule extends W2CModuleBase {
       (i) => i.target.kind === 'table'
     ) as GeneratedSymbol<ModuleTable>[];
   }
+
+  /**
+   * Checks if specified exported function writes its results into the result buffer.
+   *
+   * Only applies to functions returning multiple values. Functions returning 64-bit
+   * integers keep returning arrays, so the integers are passed as `BigInt` without
+   * losing precision, same as when returned alone.
+   */
+  public usesResultBuffer(func: GeneratedSymbol<GeneratedModuleFunction>) {
+    const option = this.config.bridge?.multiValueResultBuffer ?? false;
+    const enabled = Array.isArray(option)
+      ? option.includes(func.localName)
+      : option;
+
+    const { resultTypes } = func.target;
+    return enabled && resultTypes.length > 1 && !resultTypes.includes('i64');
+  }
+
+  /**
+   * Number of values the result buffer of an instance must hold, or 0 if not used.
+   */
+  public get resultBufferSize(): number {
+    return Math.max(
+      0,
+      ...this.exportedFunctions
+        .filter((f) => this.usesResultBuffer(f))
+        .map((f) => f.target.resultTypes.length)
+    );
+  }
+
   /**
    * Name of the function that creates a new instance of the module.
    */
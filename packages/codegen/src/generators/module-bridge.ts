@@ -1,3 +1,4 @@
+import fs from 'node:fs/promises';
 import path from 'node:path';
 import type {
   PolygenModuleConfig,
@@ -5,6 +6,8 @@ import type {
 } from '@callstack/polygen-config';
 import consola from 'consola';
 import type { W2CGeneratedModule } from '../codegen/modules.js';
+import type { InstanceField } from '../helpers/instance-layout.js';
+import { parseInstanceLayout } from '../helpers/instance-layout.js';
 import type { OutputGenerator } from '../helpers/output-generator.js';
 import * as templates from '../templates/library/index.js';
 import { generateCSources, getOutputFilesFor } from '../wasm2c/wasm2c.js';
@@ -22,10 +25,17 @@ export async function generateModuleExportsBridge(
 ) {
   try {
     // TODO; remove generated files on dev (or always)
-    await Promise.all([
-      generateCSource(generator, module, options),
-      generateJSIBridge(generator, module),
-    ]);
+    if (module.config.bridge?.snapshot) {
+      // Snapshot code is generated from the instance struct, so the bridge waits for wasm2c
+      await generateCSource(generator, module, options);
+      const instanceLayout = await readInstanceLayout(generator, module);
+      await generateJSIBridge(generator, module, instanceLayout);
+    } else {
+      await Promise.all([
+        generateCSource(generator, module, options),
+        generateJSIBridge(generator, module),
+      ]);
+    }
   } catch (e) {
     consola.error(e);
   }
@@ -54,22 +64,42 @@ async function generateCSource(
     }
   }
 
-  const { moduleName } = moduleConfig.wasm2c ?? {};
+  const { moduleName, compressDataSegments } = moduleConfig.wasm2c ?? {};
   return generatingFromModule(generator, module, options, generatedFiles, () =>
     generateCSources(module.sourceModulePath, outputDir, {
       numOutputs,
       moduleName,
+      compressDataSegments,
     })
   );
 }
 
-async function generateJSIBridge(
+async function readInstanceLayout(
   generator: OutputGenerator,
   module: W2CGeneratedModule
+): Promise<InstanceField[]> {
+  const outputDir = path.dirname(generator.outputPathTo(module.name));
+  const header = await fs.readFile(
+    path.join(outputDir, `${module.name}.h`),
+    'utf8'
+  );
+  return parseInstanceLayout(header, module.generatedContextTypeName);
+}
+
+async function generateJSIBridge(
+  generator: OutputGenerator,
+  module: W2CGeneratedModule,
+  instanceLayout?: InstanceField[]
 ) {
   await generator.writeAllTo({
-    'jsi-exports-bridge.h': templates.buildExportBridgeHeader(module),
-    'jsi-exports-bridge.cpp': templates.buildExportBridgeSource(module),
+    'jsi-exports-bridge.h': templates.buildExportBridgeHeader(
+      module,
+      instanceLayout
+    ),
+    'jsi-exports-bridge.cpp': templates.buildExportBridgeSource(
+      module,
+      instanceLayout
+    ),
     'static-module.h': templates.buildStaticLibraryHeader(module),
     'static-module.cpp': templates.buildStaticLibrarySource(module),
   });
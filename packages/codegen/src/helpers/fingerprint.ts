@@ -0,0 +1,116 @@
+import { xxh3 } from './xxhash.js';
+
+/**
+ * Cheap fingerprint of a WebAssembly module binary.
+ *
+ * Must be kept in sync with `computeModuleFingerprint()` in `utils/checksum.h`.
+ */
+export interface ModuleFingerprint {
+  /**
+   * Size of the module in bytes.
+   */
+  size: number;
+
+  /**
+   * XXH3 hash of the module header and blocks sampled evenly from the rest of the module.
+   */
+  contentHash: bigint;
+
+  /**
+   * XXH3 hash of the section layout, as a list of section ids and sizes.
+   */
+  layoutHash: bigint;
+}
+
+const WASM_PREAMBLE = [0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00];
+const BLOCK_SIZE = 256;
+const SAMPLED_BLOCK_COUNT = 16;
+const SAMPLE_SIZE = BLOCK_SIZE * (SAMPLED_BLOCK_COUNT + 1);
+
+function computeContentHash(data: Uint8Array): bigint {
+  if (data.length <= SAMPLE_SIZE) {
+    return xxh3(data);
+  }
+
+  // Header block is followed by blocks spread evenly over the rest, the last one ending the module
+  const sample = new Uint8Array(SAMPLE_SIZE);
+  sample.set(data.subarray(0, BLOCK_SIZE));
+
+  const sampledRange = data.length - 2 * BLOCK_SIZE;
+  for (let i = 0; i < SAMPLED_BLOCK_COUNT; i++) {
+    const offset =
+      BLOCK_SIZE + Math.floor((sampledRange * i) / (SAMPLED_BLOCK_COUNT - 1));
+    sample.set(data.subarray(offset, offset + BLOCK_SIZE), BLOCK_SIZE * (i + 1));
+  }
+
+  return xxh3(sample);
+}
+
+function computeLayoutHash(data: Uint8Array): bigint {
+  // Each section is recorded as its id followed by its little-endian 32-bit size
+  const layout: number[] = [];
+  let offset = WASM_PREAMBLE.length;
+  while (offset < data.length) {
+    const sectionId = data[offset++]!;
+
+    let sectionSize = 0;
+    for (let shift = 0; ; shift += 7) {
+      if (offset >= data.length || shift > 28) {
+        throw new Error('Malformed WebAssembly module section header');
+      }
+      const byte = data[offset++]!;
+      sectionSize = (sectionSize | ((byte & 0x7f) << shift)) >>> 0;
+      if ((byte & 0x80) === 0) {
+        break;
+      }
+    }
+
+    if (sectionSize > data.length - offset) {
+      throw new Error('WebAssembly module section exceeds module size');
+    }
+    offset += sectionSize;
+
+    layout.push(
+      sectionId,
+      sectionSize & 0xff,
+      (sectionSize >>> 8) & 0xff,
+      (sectionSize >>> 16) & 0xff,
+      sectionSize >>> 24
+    );
+  }
+
+  return xxh3(new Uint8Array(layout));
+}
+
+/**
+ * Computes fingerprint of a WebAssembly module binary, used by the runtime loader
+ * to find the candidate module without hashing its full contents.
+ *
+ * @param data Contents of the module
+ */
+export function computeModuleFingerprint(data: Uint8Array): ModuleFingerprint {
+  if (!WASM_PREAMBLE.every((byte, i) => data[i] === byte)) {
+    throw new Error('Not a WebAssembly module binary');
+  }
+
+  return {
+    size: data.length,
+    contentHash: computeContentHash(data),
+    layoutHash: computeLayoutHash(data),
+  };
+}
+
+/**
+ * Serializes fingerprint to bytes, the same way as its in-memory representation
+ * in the runtime, which is used as a key of the module bag index.
+ *
+ * @param fingerprint Fingerprint to serialize
+ */
+export function fingerprintToBytes(fingerprint: ModuleFingerprint): Uint8Array {
+  const bytes = new Uint8Array(24);
+  const view = new DataView(bytes.buffer);
+  view.setBigUint64(0, BigInt(fingerprint.size), true);
+  view.setBigUint64(8, fingerprint.contentHash, true);
+  view.setBigUint64(16, fingerprint.layoutHash, true);
+  return bytes;
+}
@@ -0,0 +1,94 @@
+/**
+ * Kind of state held by a field of module instance struct generated by wasm2c.
+ *
+ * - `value` - plain value, e.g. a global or a flag of a dropped segment
+ * - `memory` - memory defined by the module
+ * - `funcref-table` / `externref-table` - table defined by the module
+ * - `unsupported` - state that cannot be saved, e.g. a reference global
+ */
+export type InstanceFieldKind =
+  | 'value'
+  | 'memory'
+  | 'funcref-table'
+  | 'externref-table'
+  | 'unsupported';
+
+/**
+ * Field of module instance struct generated by wasm2c, holding state of the instance.
+ */
+export interface InstanceField {
+  name: string;
+  type: string;
+  kind: InstanceFieldKind;
+}
+
+const VALUE_TYPES = new Set([
+  'bool',
+  'u8',
+  'u16',
+  'u32',
+  'u64',
+  's8',
+  's16',
+  's32',
+  's64',
+  'f32',
+  'f64',
+  'v128',
+]);
+
+const FIELD_PATTERN = /^(?:const\s+)?((?:struct\s+)?\w+)\s*(\*?)\s*(\w+)\s*(?::\s*\d+\s*)?;$/;
+
+function getFieldKind(type: string): InstanceFieldKind {
+  if (VALUE_TYPES.has(type)) {
+    return 'value';
+  }
+
+  switch (type) {
+    case 'wasm_rt_memory_t':
+      return 'memory';
+    case 'wasm_rt_funcref_table_t':
+      return 'funcref-table';
+    case 'wasm_rt_externref_table_t':
+      return 'externref-table';
+    default:
+      return 'unsupported';
+  }
+}
+
+/**
+ * Reads fields holding state of a module instance from the header generated by wasm2c.
+ *
+ * Pointer fields refer to imported modules and their symbols, which are not state
+ * of the instance, so they are skipped.
+ *
+ * @param header Contents of the header generated by wasm2c
+ * @param typeName Name of the module instance struct, e.g. `w2c_example`
+ */
+export function parseInstanceLayout(
+  header: string,
+  typeName: string
+): InstanceField[] {
+  const start = header.indexOf(`typedef struct ${typeName} {`);
+  const end = header.indexOf(`} ${typeName};`, start);
+  if (start === -1 || end === -1) {
+    throw new Error(`Could not find definition of ${typeName} struct`);
+  }
+
+  const body = header
+    .slice(header.indexOf('{', start) + 1, end)
+    .replace(/\/\*[\s\S]*?\*\//g, '');
+
+  const fields: InstanceField[] = [];
+  for (const line of body.split('\n').map((l) => l.trim())) {
+    const match = FIELD_PATTERN.exec(line);
+    if (!match || match[2] === '*') {
+      continue;
+    }
+
+    const [, type, , name] = match;
+    fields.push({ name: name!, type: type!, kind: getFieldKind(type!) });
+  }
+
+  return fields;
+}
@@ -0,0 +1,83 @@
+/**
+ * Perfect hash table over a fixed set of keys.
+ *
+ * Slots hold index of the key increased by one, or zero for empty slots.
+ */
+export interface PerfectHashTable {
+  seed: number;
+  slots: number[];
+}
+
+const FNV_OFFSET_BASIS = 0x811c9dc5;
+const FNV_PRIME = 0x01000193;
+
+/**
+ * Maximum number of seeds tried before the table size is doubled.
+ */
+const MAX_SEED_ATTEMPTS = 1024;
+
+/**
+ * Computes seeded 32-bit FNV-1a hash of specified key.
+ *
+ * Must be kept in sync with `hashModuleBagKey()` in `ModuleBag.h`.
+ *
+ * @param key Bytes of the key
+ * @param seed Seed selected for the table
+ */
+export function hashKey(key: Uint8Array, seed: number): number {
+  let hash = (FNV_OFFSET_BASIS ^ seed) >>> 0;
+  for (const byte of key) {
+    hash = Math.imul(hash ^ byte, FNV_PRIME) >>> 0;
+  }
+  return hash;
+}
+
+/**
+ * Builds a perfect hash table for specified keys, by searching for a seed
+ * that maps every key to a distinct slot.
+ *
+ * Table size is always a power of two, so slot is selected by masking the hash.
+ * Duplicate keys resolve to the first occurrence.
+ *
+ * @param keys Keys to build table for
+ */
+export function buildPerfectHashTable(keys: Uint8Array[]): PerfectHashTable {
+  const seen = new Set<string>();
+  const uniqueKeys = keys
+    .map((key, index) => ({ key, index }))
+    .filter(({ key }) => {
+      const id = Buffer.from(key).toString('hex');
+      if (seen.has(id)) {
+        return false;
+      }
+
+      seen.add(id);
+      return true;
+    });
+
+  let size = 1;
+  while (size < uniqueKeys.length * 2) {
+    size *= 2;
+  }
+
+  for (;;) {
+    for (let seed = 0; seed < MAX_SEED_ATTEMPTS; seed++) {
+      const slots = new Array<number>(size).fill(0);
+      const isPerfect = uniqueKeys.every(({ key, index }) => {
+        const slot = hashKey(key, seed) & (size - 1);
+        if (slots[slot] !== 0) {
+          return false;
+        }
+
+        slots[slot] = index + 1;
+        return true;
+      });
+
+      if (isPerfect) {
+        return { seed, slots };
+      }
+    }
+
+    size *= 2;
+  }
+}
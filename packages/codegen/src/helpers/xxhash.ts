@@ -0,0 +1,262 @@
+const MASK_64 = (1n << 64n) - 1n;
+
+const PRIME32_1 = 0x9e3779b1n;
+const PRIME32_2 = 0x85ebca77n;
+const PRIME32_3 = 0xc2b2ae3dn;
+const PRIME64_1 = 0x9e3779b185ebca87n;
+const PRIME64_2 = 0xc2b2ae3d27d4eb4fn;
+const PRIME64_3 = 0x165667b19e3779f9n;
+const PRIME64_4 = 0x85ebca77c2b2ae63n;
+const PRIME64_5 = 0x27d4eb2f165667c5n;
+
+const STRIPE_SIZE = 64;
+const SECRET_CONSUME_RATE = 8;
+const SECRET_MERGE_ACCS_START = 11;
+const SECRET_LAST_ACC_START = 7;
+const MID_SIZE_MAX = 240;
+const SECRET_SIZE_MIN = 136;
+
+// prettier-ignore
+const SECRET = new Uint8Array([
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+]);
+
+function read32(data: Uint8Array, offset: number): bigint {
+  return BigInt(
+    (data[offset]! |
+      (data[offset + 1]! << 8) |
+      (data[offset + 2]! << 16) |
+      (data[offset + 3]! << 24)) >>>
+      0
+  );
+}
+
+function read64(data: Uint8Array, offset: number): bigint {
+  return read32(data, offset) | (read32(data, offset + 4) << 32n);
+}
+
+function mul64(lhs: bigint, rhs: bigint): bigint {
+  return (lhs * rhs) & MASK_64;
+}
+
+function rotl64(value: bigint, bits: bigint): bigint {
+  return ((value << bits) | (value >> (64n - bits))) & MASK_64;
+}
+
+function bswap64(value: bigint): bigint {
+  let result = 0n;
+  for (let i = 0; i < 8; i++) {
+    result = (result << 8n) | (value & 0xffn);
+    value >>= 8n;
+  }
+  return result;
+}
+
+function mul128Fold64(lhs: bigint, rhs: bigint): bigint {
+  const product = lhs * rhs;
+  return (product & MASK_64) ^ (product >> 64n);
+}
+
+function xxh64Avalanche(h: bigint): bigint {
+  h ^= h >> 33n;
+  h = mul64(h, PRIME64_2);
+  h ^= h >> 29n;
+  h = mul64(h, PRIME64_3);
+  h ^= h >> 32n;
+  return h;
+}
+
+function avalanche(h: bigint): bigint {
+  h ^= h >> 37n;
+  h = mul64(h, 0x165667919e3779f9n);
+  h ^= h >> 32n;
+  return h;
+}
+
+function rrmxmx(h: bigint, length: number): bigint {
+  h ^= rotl64(h, 49n) ^ rotl64(h, 24n);
+  h = mul64(h, 0x9fb21c651e98df25n);
+  h ^= ((h >> 35n) + BigInt(length)) & MASK_64;
+  h = mul64(h, 0x9fb21c651e98df25n);
+  h ^= h >> 28n;
+  return h;
+}
+
+function mix16(data: Uint8Array, offset: number, secretOffset: number): bigint {
+  return mul128Fold64(
+    read64(data, offset) ^ read64(SECRET, secretOffset),
+    read64(data, offset + 8) ^ read64(SECRET, secretOffset + 8)
+  );
+}
+
+function hash0To16(data: Uint8Array): bigint {
+  const length = data.length;
+  if (length > 8) {
+    const lo = read64(data, 0) ^ read64(SECRET, 24) ^ read64(SECRET, 32);
+    const hi = read64(data, length - 8) ^ read64(SECRET, 40) ^ read64(SECRET, 48);
+    const acc = BigInt(length) + bswap64(lo) + hi + mul128Fold64(lo, hi);
+    return avalanche(acc & MASK_64);
+  }
+  if (length >= 4) {
+    const combined = read32(data, length - 4) + (read32(data, 0) << 32n);
+    return rrmxmx(combined ^ read64(SECRET, 8) ^ read64(SECRET, 16), length);
+  }
+  if (length > 0) {
+    const combined =
+      (data[0]! << 16) |
+      (data[length >> 1]! << 24) |
+      data[length - 1]! |
+      (length << 8);
+    return xxh64Avalanche(
+      BigInt(combined >>> 0) ^ read32(SECRET, 0) ^ read32(SECRET, 4)
+    );
+  }
+  return xxh64Avalanche(read64(SECRET, 56) ^ read64(SECRET, 64));
+}
+
+function hash17To128(data: Uint8Array): bigint {
+  const length = data.length;
+  let acc = BigInt(length) * PRIME64_1;
+  if (length > 32) {
+    if (length > 64) {
+      if (length > 96) {
+        acc += mix16(data, 48, 96);
+        acc += mix16(data, length - 64, 112);
+      }
+      acc += mix16(data, 32, 64);
+      acc += mix16(data, length - 48, 80);
+    }
+    acc += mix16(data, 16, 32);
+    acc += mix16(data, length - 32, 48);
+  }
+  acc += mix16(data, 0, 0);
+  acc += mix16(data, length - 16, 16);
+  return avalanche(acc & MASK_64);
+}
+
+function hash129To240(data: Uint8Array): bigint {
+  const length = data.length;
+  const roundCount = Math.floor(length / 16);
+  let acc = BigInt(length) * PRIME64_1;
+  for (let i = 0; i < 8; i++) {
+    acc += mix16(data, 16 * i, 16 * i);
+  }
+  acc = avalanche(acc & MASK_64);
+  for (let i = 8; i < roundCount; i++) {
+    acc += mix16(data, 16 * i, 16 * (i - 8) + 3);
+  }
+  acc += mix16(data, length - 16, SECRET_SIZE_MIN - 17);
+  return avalanche(acc & MASK_64);
+}
+
+function accumulateStripe(
+  acc: bigint[],
+  data: Uint8Array,
+  offset: number,
+  secretOffset: number
+) {
+  for (let i = 0; i < 8; i++) {
+    const value = read64(data, offset + 8 * i);
+    const key = value ^ read64(SECRET, secretOffset + 8 * i);
+    acc[i ^ 1] = (acc[i ^ 1]! + value) & MASK_64;
+    acc[i] = (acc[i]! + (key & 0xffffffffn) * (key >> 32n)) & MASK_64;
+  }
+}
+
+function scrambleAccumulators(acc: bigint[], secretOffset: number) {
+  for (let i = 0; i < 8; i++) {
+    let value = acc[i]!;
+    value ^= value >> 47n;
+    value ^= read64(SECRET, secretOffset + 8 * i);
+    acc[i] = mul64(value, PRIME32_1);
+  }
+}
+
+function hashLong(data: Uint8Array): bigint {
+  const length = data.length;
+  const acc = [
+    PRIME32_3,
+    PRIME64_1,
+    PRIME64_2,
+    PRIME64_3,
+    PRIME64_4,
+    PRIME32_2,
+    PRIME64_5,
+    PRIME32_1,
+  ];
+
+  const stripesPerBlock = (SECRET.length - STRIPE_SIZE) / SECRET_CONSUME_RATE;
+  const blockSize = STRIPE_SIZE * stripesPerBlock;
+  const blockCount = Math.floor((length - 1) / blockSize);
+
+  for (let block = 0; block < blockCount; block++) {
+    for (let stripe = 0; stripe < stripesPerBlock; stripe++) {
+      accumulateStripe(
+        acc,
+        data,
+        block * blockSize + stripe * STRIPE_SIZE,
+        stripe * SECRET_CONSUME_RATE
+      );
+    }
+    scrambleAccumulators(acc, SECRET.length - STRIPE_SIZE);
+  }
+
+  const lastStripeCount = Math.floor(
+    (length - 1 - blockSize * blockCount) / STRIPE_SIZE
+  );
+  for (let stripe = 0; stripe < lastStripeCount; stripe++) {
+    accumulateStripe(
+      acc,
+      data,
+      blockCount * blockSize + stripe * STRIPE_SIZE,
+      stripe * SECRET_CONSUME_RATE
+    );
+  }
+  accumulateStripe(
+    acc,
+    data,
+    length - STRIPE_SIZE,
+    SECRET.length - STRIPE_SIZE - SECRET_LAST_ACC_START
+  );
+
+  let result = BigInt(length) * PRIME64_1;
+  for (let i = 0; i < 4; i++) {
+    const secretOffset = SECRET_MERGE_ACCS_START + 16 * i;
+    result += mul128Fold64(
+      acc[2 * i]! ^ read64(SECRET, secretOffset),
+      acc[2 * i + 1]! ^ read64(SECRET, secretOffset + 8)
+    );
+  }
+  return avalanche(result & MASK_64);
+}
+
+/**
+ * Computes 64-bit XXH3 hash of the data, using default secret and zero seed.
+ *
+ * Must be kept in sync with `computeXXH3()` in `utils/xxhash.h`.
+ *
+ * @param data Data to hash
+ */
+export function xxh3(data: Uint8Array): bigint {
+  if (data.length <= 16) {
+    return hash0To16(data);
+  }
+  if (data.length <= 128) {
+    return hash17To128(data);
+  }
+  if (data.length <= MID_SIZE_MAX) {
+    return hash129To240(data);
+  }
+  return hashLong(data);
+}
@@ -1,6 +1,16 @@
+import type { MemoryCheckStrategy } from '@callstack/polygen-config';
 import stripIndent from 'strip-indent';
 import type { Plugin } from '../../plugin.js';
 
+/**
+ * Preprocessor definitions selecting memory check strategy in `wasm-rt.h`.
+ */
+const MEMORY_CHECK_DEFINITIONS: Record<MemoryCheckStrategy, string[]> = {
+  auto: [],
+  'guard-pages': ['POLYGEN_MEMCHECK_GUARD_PAGES=1'],
+  'bounds-check': ['POLYGEN_MEMCHECK_BOUNDS_CHECK=1'],
+};
+
 /**
  * Plugin that generates the ReactNativeWebAssemblyHost podspec.
  */
@@ -9,9 +19,10 @@ export function cocoapods(): Plugin {
     name: 'core/ios-cocoapods',
     title: 'CocoaPods Integration',
 
-    async hostProjectGenerated({ projectOutput }): Promise<void> {
+    async hostProjectGenerated({ codegen, projectOutput }): Promise<void> {
+      const { memoryCheck } = codegen.project.options.output;
       await projectOutput.writeAllTo({
-        'ReactNativeWebAssemblyHost.podspec': buildPodspecSource(),
+        'ReactNativeWebAssemblyHost.podspec': buildPodspecSource(memoryCheck),
       });
     },
   };
@@ -20,7 +31,9 @@ export function cocoapods(): Plugin {
 /**
  * Builds the podspec source for the ReactNativeWebAssemblyHost pod.
  */
-function buildPodspecSource() {
+function buildPodspecSource(memoryCheck: MemoryCheckStrategy) {
+  const definitions = ['$(inherited)', ...MEMORY_CHECK_DEFINITIONS[memoryCheck]];
+
   return stripIndent(
     `
     require "json"
@@ -49,6 +62,8 @@ function buildPodspecSource() {
       s.pod_target_xcconfig = {
           "HEADER_SEARCH_PATHS" => "\\"$(PODS_ROOT)/boost\\"",
           "OTHER_CPLUSPLUSFLAGS" => "-DFOLLY_NO_CONFIG -DFOLLY_MOBILE=1 -DFOLLY_USE_LIBCPP=1",
+          "OTHER_CFLAGS" => "-fno-exceptions -fno-asynchronous-unwind-tables",
+          "GCC_PREPROCESSOR_DEFINITIONS" => "${definitions.join(' ')}",
           "CLANG_CXX_LANGUAGE_STANDARD" => "c++17"
       }
 
@@ -65,6 +80,8 @@ function buildPodspecSource() {
           s.pod_target_xcconfig    = {
               "HEADER_SEARCH_PATHS" => "\\"$(PODS_ROOT)/boost\\"",
               "OTHER_CPLUSPLUSFLAGS" => "-DFOLLY_NO_CONFIG -DFOLLY_MOBILE=1 -DFOLLY_USE_LIBCPP=1",
+              "OTHER_CFLAGS" => "-fno-exceptions -fno-asynchronous-unwind-tables",
+              "GCC_PREPROCESSOR_DEFINITIONS" => "${definitions.join(' ')}",
               "CLANG_CXX_LANGUAGE_STANDARD" => "c++17"
           }
           s.dependency "React-Codegen"
@@ -10,11 +10,16 @@ export function reactNativeTurboModule(): Plugin {
     title: 'React Native TurboModule',
 
     async hostProjectGenerated({
+      codegen,
       projectOutput,
       generatedModules,
     }): Promise<void> {
+      const { moduleVerification } = codegen.project.options.output;
       await projectOutput.writeAllTo({
-        'loader.cpp': templates.buildLoaderSource(generatedModules),
+        'loader.cpp': templates.buildLoaderSource(
+          generatedModules,
+          moduleVerification
+        ),
       });
     },
   };
@@ -16,6 +16,14 @@ export const TABLE_KIND_TO_NATIVE_C_TYPE: Record<RefType, string> = {
   externref: 'wasm_rt_externref_table_t',
 };
 
+/**
+ * Mapping from WebAssembly table kind to the native C type of its elements, used by `wasm2c`.
+ */
+export const TABLE_KIND_TO_NATIVE_ELEMENT_C_TYPE: Record<RefType, string> = {
+  funcref: 'wasm_rt_funcref_t',
+  externref: 'wasm_rt_externref_t',
+};
+
 /**
  * Mapping from WebAssembly table kind to the name of corresponding C++ class.
  *
@@ -43,16 +51,48 @@ export const STRUCT_TYPE_PREFIX: Record<ValueType, string> = {
   // exnref
 };
 
-export function toJSINumber(expr: string, type: ValueType): string {
+/**
+ * Converts native WebAssembly value to a double, as used by result buffers.
+ *
+ * 64-bit integers above 2^53 would lose precision, so they are never written to result buffers.
+ */
+export function toDouble(expr: string, type: ValueType): string {
   const cType = type.replace('i', 's'); // i32 -> s32
-  return `jsi::Value { (double)std::bit_cast<${cType}>(${expr}) }`;
+  return `(double)std::bit_cast<${cType}>(${expr})`;
+}
+
+/**
+ * Converts native WebAssembly value to JSI value.
+ *
+ * 64-bit integers are passed as `BigInt`, all other types as numbers.
+ */
+export function toJSINumber(
+  expr: string,
+  type: ValueType,
+  rt: string = 'rt'
+): string {
+  if (type === 'i64') {
+    return `jsi::Value { jsi::BigInt::fromInt64(${rt}, std::bit_cast<s64>(${expr})) }`;
+  }
+
+  return `jsi::Value { ${toDouble(expr, type)} }`;
 }
 
+/**
+ * Converts JSI value to native WebAssembly value.
+ *
+ * 64-bit integers are read from `BigInt` values, falling back to numbers.
+ */
 export function fromJSINumber(
   expr: string,
   type: ValueType,
-  w2cType: string
+  w2cType: string,
+  rt: string = 'rt'
 ): string {
+  if (type === 'i64') {
+    return `std::bit_cast<${w2cType}>(coerceToInt64(${rt}, ${expr}))`;
+  }
+
   const cType = type.replace('i', 's'); // i32 -> s32
   return `std::bit_cast<${w2cType}>(coerceToNumber<${cType}>(${expr}))`;
 }
@@ -1,39 +1,124 @@
+import type { ModuleVerificationStrategy } from '@callstack/polygen-config';
 import type { W2CGeneratedModule } from '../codegen/modules.js';
+import type { ModuleFingerprint } from '../helpers/fingerprint.js';
+import { fingerprintToBytes } from '../helpers/fingerprint.js';
+import { buildPerfectHashTable } from '../helpers/perfect-hash.js';
+import type { PerfectHashTable } from '../helpers/perfect-hash.js';
 import { cpp } from '../source-builder/index.js';
 import { HEADER } from './common.js';
 
-export function buildLoaderSource(generatedModules: W2CGeneratedModule[]) {
+/**
+ * Values of `ModuleVerification` enum from `ModuleBag.h`.
+ */
+const MODULE_VERIFICATION: Record<ModuleVerificationStrategy, string> = {
+  strict: 'ModuleVerification::Strict',
+  cached: 'ModuleVerification::Cached',
+  fingerprint: 'ModuleVerification::Fingerprint',
+};
+
+export function buildLoaderSource(
+  generatedModules: W2CGeneratedModule[],
+  moduleVerification: ModuleVerificationStrategy
+) {
   const moduleBagType = new cpp.TypeBuilder('ModuleBag');
 
   function makeModuleFactoryDecl(module: W2CGeneratedModule) {
     return `std::shared_ptr<Module> ${module.moduleFactoryFunctionName}();`;
   }
 
+  function makeChecksumBytes(checksum: Buffer) {
+    return cpp.exprs.initializerListOf(
+      [...checksum].map((byte) =>
+        cpp.exprs.symbol(`0x${byte.toString(16).padStart(2, '0')}`)
+      )
+    );
+  }
+
+  function makeFingerprint(fingerprint: ModuleFingerprint) {
+    const toHex = (value: bigint) => `0x${value.toString(16)}ull`;
+    return cpp.exprs.initializerListOf([
+      cpp.exprs.symbol(`${fingerprint.size}`),
+      cpp.exprs.symbol(toHex(fingerprint.contentHash)),
+      cpp.exprs.symbol(toHex(fingerprint.layoutHash)),
+    ]);
+  }
+
+  function makeIndexVar(name: string, table: PerfectHashTable) {
+    return new cpp.VariableBuilder(name)
+      .withType((t) =>
+        t.of(`static constexpr std::array<uint16_t, ${table.slots.length}>`)
+      )
+      .withInitializer((e) =>
+        e.listOf(table.slots.map((slot) => cpp.exprs.symbol(`${slot}`)))
+      );
+  }
+
   const moduleEntries = generatedModules.map((m) =>
     cpp.exprs.initializerListOf([
       cpp.exprs.string(m.name),
-      cpp.exprs.string(m.checksum.toString('hex')),
-      cpp.exprs.symbol(m.moduleFactoryFunctionName),
+      makeChecksumBytes(m.checksum),
+      makeFingerprint(m.fingerprint),
+      cpp.exprs.symbol(m.moduleFactoryFunctionName).addressOf(),
     ])
   );
 
+  const moduleEntriesVar = new cpp.VariableBuilder('moduleBagEntries')
+    .withType((t) =>
+      t.of(
+        `static constexpr std::array<ModuleBagEntry, ${generatedModules.length}>`
+      )
+    )
+    // Inner braces initialize the array wrapped by `std::array`
+    .withInitializer((v) => v.initializerListOf(moduleEntries, true), true);
+
+  // Keys are hashed at runtime by `hashModuleBagKey()` from `ModuleBag.h`
+  const nameIndex = buildPerfectHashTable(
+    generatedModules.map((m) => new TextEncoder().encode(m.name))
+  );
+  const fingerprintIndex = buildPerfectHashTable(
+    generatedModules.map((m) => fingerprintToBytes(m.fingerprint))
+  );
+  const nameIndexVar = makeIndexVar('moduleNameSlots', nameIndex);
+  const fingerprintIndexVar = makeIndexVar(
+    'moduleFingerprintSlots',
+    fingerprintIndex
+  );
+
   const moduleBagVar = new cpp.VariableBuilder('moduleBag')
-    .withType(moduleBagType.asConst())
-    .withInitializer((v) => v.listOf(moduleEntries, true), true);
+    .withType((t) => t.of(`constinit ${moduleBagType.asConst()}`))
+    .withInitializer((v) =>
+      v.listOf([
+        cpp.exprs.symbol(moduleEntriesVar.name),
+        cpp.exprs.initializerListOf([
+          cpp.exprs.symbol(`${nameIndex.seed}`),
+          cpp.exprs.symbol(nameIndexVar.name),
+        ]),
+        cpp.exprs.initializerListOf([
+          cpp.exprs.symbol(`${fingerprintIndex.seed}`),
+          cpp.exprs.symbol(fingerprintIndexVar.name),
+        ]),
+        cpp.exprs.symbol(MODULE_VERIFICATION[moduleVerification]),
+      ])
+    );
 
   const moduleBagGetterFunc = new cpp.FunctionBuilder('getModuleBag')
-    .withReturnType(moduleBagVar.type.asRef())
+    .withReturnType(moduleBagType.asConstRef())
     .withBody((b) => b.return_(moduleBagVar.name));
 
   const builder = new cpp.SourceFileBuilder(true);
   builder
     .insertRaw(HEADER)
+    .includeSystem('array')
     .includeSystem('ReactNativePolygen/Loader.h')
     .spacing(1)
     .namespace('callstack::polygen::generated', (builder) =>
       builder
         .writeManyLines(generatedModules, makeModuleFactoryDecl)
         .spacing(1)
+        .defineVariable(moduleEntriesVar)
+        .defineVariable(nameIndexVar)
+        .defineVariable(fingerprintIndexVar)
+        .spacing(1)
         .defineVariable(moduleBagVar)
         .defineFunction(moduleBagGetterFunc)
     );
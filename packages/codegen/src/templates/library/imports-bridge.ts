@@ -14,7 +14,6 @@ import { matchSymbol } from '../../codegen/utils.js';
 import { cpp } from '../../source-builder/index.js';
 import {
   HEADER,
-  STRUCT_TYPE_PREFIX,
   TABLE_KIND_TO_CLASS_NAME,
   TABLE_KIND_TO_NATIVE_C_TYPE,
   fromJSINumber,
@@ -39,18 +38,41 @@ export function buildImportBridgeHeader(importedModule: W2CExternModule) {
   const decls = [...importedModule.exports.values().map(makeDeclaration)].join(
     '\n'
   );
+  const ctxTypeName = importedModule.generatedContextTypeName;
+  const functionFields = importedFunctionsOf(importedModule).map(
+    (f) =>
+      `std::optional<facebook::jsi::Function> ${importedFunctionFieldName(f)};`
+  );
 
   return (
     HEADER +
     stripIndent(`
     #pragma once
+    #include <optional>
     #include <wasm-rt.h>
     #include <ReactNativePolygen/gen-utils.h>
 
-    struct ${importedModule.generatedContextTypeName} {
+    struct ${ctxTypeName} {
+      ${ctxTypeName}(void* root, facebook::jsi::Runtime& rt, facebook::jsi::Object&& importObj);
+
+      /**
+       * Resolves all imported functions again from specified object of the imported module.
+       *
+       * Imported functions are resolved only once, when the context is created,
+       * so this is the only way to change functions called by the module afterwards.
+       * The import object is kept, as imported memories, tables and globals are read from it.
+       */
+      void rebindFunctions(const facebook::jsi::Object& source);
+
       void* root;
       facebook::jsi::Runtime& rt;
       facebook::jsi::Object importObj;
+
+      // Imported functions resolved from import object, empty if not provided
+      ${functionFields.join('\n      ')}
+
+    private:
+      void resolveImportedFunctions(const facebook::jsi::Object& source);
     };
 
     #ifdef __cplusplus
@@ -81,16 +103,36 @@ export function buildImportBridgeSource(importedModule: W2CExternModule) {
     }
   }
 
+  const ctxTypeName = importedModule.generatedContextTypeName;
+  const resolvedFunctions = importedFunctionsOf(importedModule).map(
+    (f) =>
+      `${importedFunctionFieldName(f)} = resolveImportedFunction(rt, source, "${f.localName}");`
+  );
+
   return (
     HEADER +
     stripIndent(`
     #include "${importedModule.name}-imports.h"
     #include <ReactNativePolygen/WebAssembly.h>
     #include <ReactNativePolygen/NativeStateHelper.h>
+    #include <ReactNativePolygen/TrapBoundary.h>
 
     using namespace facebook;
     using namespace callstack::polygen;
 
+    ${ctxTypeName}::${ctxTypeName}(void* root, jsi::Runtime& rt, jsi::Object&& importObj)
+      : root(root), rt(rt), importObj(std::move(importObj)) {
+      resolveImportedFunctions(this->importObj);
+    }
+
+    void ${ctxTypeName}::rebindFunctions(const jsi::Object& source) {
+      resolveImportedFunctions(source);
+    }
+
+    void ${ctxTypeName}::resolveImportedFunctions(const jsi::Object& source) {
+      ${resolvedFunctions.join('\n      ')}
+    }
+
     #ifdef __cplusplus
     extern "C" {
     #endif
@@ -104,6 +146,26 @@ export function buildImportBridgeSource(importedModule: W2CExternModule) {
   );
 }
 
+/**
+ * Returns all functions imported from specified module, by any generated module.
+ */
+function importedFunctionsOf(
+  importedModule: W2CExternModule
+): GeneratedSymbol<GeneratedModuleFunction>[] {
+  return [...importedModule.exports.values()].filter(
+    (s) => s.target.kind === 'function'
+  ) as GeneratedSymbol<GeneratedModuleFunction>[];
+}
+
+/**
+ * Name of the import context field holding resolved imported function.
+ */
+function importedFunctionFieldName(
+  func: GeneratedSymbol<GeneratedModuleFunction>
+): string {
+  return `fn_${func.mangledLocalName}`;
+}
+
 function wrapJSIReturnIntoNative(
   varName: string,
   func: ResolvedModuleImport<GeneratedModuleFunction>
@@ -113,14 +175,20 @@ function wrapJSIReturnIntoNative(
   // Handle multiple value types (struct)
   if (resultTypes.length > 1) {
     const elements = resultTypes.map((t, i) =>
-      toJSINumber(`${varName}.${STRUCT_TYPE_PREFIX[t]}${i}`, t)
+      fromJSINumber(
+        `results.getValueAtIndex(ctx->rt, ${i})`,
+        t,
+        t.replace('i', 'u'),
+        'ctx->rt'
+      )
     );
 
-    return `return ${cpp.exprs.initializerListOf(elements).toString()}`;
+    return `auto results = ${varName}.asObject(ctx->rt).asArray(ctx->rt);
+    return ${cpp.exprs.initializerListOf(elements).toString()}`;
   }
 
   if (resultTypes.length === 1) {
-    return `return ${fromJSINumber('res', resultTypes[0]!, returnTypeName)}`;
+    return `return ${fromJSINumber(varName, resultTypes[0]!, returnTypeName, 'ctx->rt')}`;
   }
 
   return 'return';
@@ -139,17 +207,23 @@ function makeImportFunc(
     .join('');
 
   const args = parametersTypes
-    .map((t, i) => toJSINumber(`arg${i}`, t))
+    .map((t, i) => toJSINumber(`arg${i}`, t, 'ctx->rt'))
     .map((e) => `, ${e}`)
     .join('');
 
   const hasReturn = resultTypes.length > 0;
 
   const prototype = `${returnTypeName} ${func.functionSymbolAccessorName}(${func.module.generatedContextTypeName}* ctx${declarationParams})`;
+  const fieldName = importedFunctionFieldName(func);
   const body = `{
-    auto fn = ctx->importObj.getPropertyAsFunction(ctx->rt, "${func.localName}");
-    ${hasReturn ? 'auto res = ' : ''}fn.call(ctx->rt${args});
-    ${wrapJSIReturnIntoNative('res', func)};
+    return callImportFromWasm([&]() -> ${returnTypeName} {
+      if (!ctx->${fieldName}) [[unlikely]] {
+        throw jsi::JSError(ctx->rt, "Imported function '${func.localName}' is not provided");
+      }
+
+      ${hasReturn ? 'auto res = ' : ''}ctx->${fieldName}->call(ctx->rt${args});
+      ${wrapJSIReturnIntoNative('res', func)};
+    });
   }
   `;
 
@@ -166,19 +240,21 @@ function makeImportGlobal(
   const cType = global.target.type.replace('i', 'u') + '*';
   const prototype = `${cType} ${global.functionSymbolAccessorName}(${global.module.generatedContextTypeName}* ctx)`;
   const body = `{
-      auto target = ctx->importObj.getProperty(ctx->rt, "${global.localName}");
+      return callImportFromWasm([&] {
+        auto target = ctx->importObj.getProperty(ctx->rt, "${global.localName}");
 
-      if (target.isUndefined()) [[unlikely]] {
-        throw jsi::JSError(ctx->rt, "Provided imported variable '${global.localName}' is not provided");
-      }
+        if (target.isUndefined()) [[unlikely]] {
+          throw jsi::JSError(ctx->rt, "Provided imported variable '${global.localName}' is not provided");
+        }
 
-      if (!target.isObject()) [[unlikely]] {
-        throw jsi::JSError(ctx->rt, "Provided imported variable '${global.localName}' is not an instance of WebAssembly.Global");
-      }
+        if (!target.isObject()) [[unlikely]] {
+          throw jsi::JSError(ctx->rt, "Provided imported variable '${global.localName}' is not an instance of WebAssembly.Global");
+        }
 
-      auto obj = target.asObject(ctx->rt);
-      auto global = NativeStateHelper::tryGet<Global>(ctx->rt, obj);
-      return (${cType})global->getUnsafePayloadPtr();
+        auto obj = target.asObject(ctx->rt);
+        auto global = NativeStateHelper::tryGet<Global>(ctx->rt, obj);
+        return (${cType})global->getUnsafePayloadPtr();
+      });
     }
   `;
 
@@ -194,9 +270,11 @@ function makeImportMemory(
 ): string {
   const prototype = `wasm_rt_memory_t* ${memory.functionSymbolAccessorName}(${memory.module.generatedContextTypeName}* ctx)`;
   const body = `{
-    auto memoryHolder = ctx->importObj.getPropertyAsObject(ctx->rt, "${memory.localName}");
-    auto memoryState = NativeStateHelper::tryGet<Memory>(ctx->rt, memoryHolder);
-    return memoryState->getMemory();
+    return callImportFromWasm([&] {
+      auto memoryHolder = ctx->importObj.getPropertyAsObject(ctx->rt, "${memory.localName}");
+      auto memoryState = NativeStateHelper::tryGet<Memory>(ctx->rt, memoryHolder);
+      return memoryState->getMemory();
+    });
   }`;
 
   return `
@@ -211,10 +289,12 @@ function makeImportTable(
 ): string {
   const prototype = `${TABLE_KIND_TO_NATIVE_C_TYPE[table.target.elementType]}* ${table.functionSymbolAccessorName}(${table.module.generatedContextTypeName}* ctx)`;
   const body = `{
-    auto tableHolder = ctx->importObj.getPropertyAsObject(ctx->rt, "${table.localName}");
-    auto table = NativeStateHelper::tryGet<${TABLE_KIND_TO_CLASS_NAME[table.target.elementType]}>(ctx->rt, tableHolder);
-    assert(table != nullptr);
-    return table->getTableData();
+    return callImportFromWasm([&] {
+      auto tableHolder = ctx->importObj.getPropertyAsObject(ctx->rt, "${table.localName}");
+      auto table = NativeStateHelper::tryGet<${TABLE_KIND_TO_CLASS_NAME[table.target.elementType]}>(ctx->rt, tableHolder);
+      assert(table != nullptr);
+      return table->getTableData();
+    });
   }`;
 
   return `
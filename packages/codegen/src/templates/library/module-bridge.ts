@@ -5,6 +5,7 @@ import type {
 } from '@callstack/wasm-parser';
 import stripIndent from 'strip-indent';
 import type { W2CGeneratedModule } from '../../codegen/modules.js';
+import type { InstanceField } from '../../helpers/instance-layout.js';
 import type {
   GeneratedModuleFunction,
   GeneratedSymbol,
@@ -13,42 +14,136 @@ import {
   HEADER,
   STRUCT_TYPE_PREFIX,
   TABLE_KIND_TO_CLASS_NAME,
+  TABLE_KIND_TO_NATIVE_ELEMENT_C_TYPE,
   fromJSINumber,
+  toDouble,
   toJSINumber,
 } from '../common.js';
 
-export function buildExportBridgeHeader(module: W2CGeneratedModule) {
+/**
+ * Name of the context member holding initial contents of a funcref table.
+ */
+function initialTableFieldName(field: InstanceField) {
+  return `initial_${field.name}`;
+}
+
+/**
+ * Copies initial contents of funcref tables, after the instance was instantiated.
+ */
+function captureInitialTables(instanceLayout: InstanceField[]) {
+  return instanceLayout
+    .filter((f) => f.kind === 'funcref-table')
+    .map(
+      (f) =>
+        `${initialTableFieldName(f)} = copyFuncRefTable(rootCtx.${f.name});`
+    )
+    .join('\n        ');
+}
+
+/**
+ * Size of storage for elements of tables with fixed size, held by the instance context,
+ * as a C++ expression. Empty if the module defines no such tables.
+ *
+ * The runtime allocates these tables from the storage in order (see `TableArena.h`).
+ */
+function tableArenaSize(module: W2CGeneratedModule): string {
+  return module.body.tables
+    .filter((t) => t.minSize > 0 && t.maxSize === t.minSize)
+    .map(
+      (t) =>
+        `sizeof(${TABLE_KIND_TO_NATIVE_ELEMENT_C_TYPE[t.elementType]}) * ${t.minSize}`
+    )
+    .join(' + ');
+}
+
+/**
+ * Sets storage of tables with fixed size for the runtime, while the instance is instantiated or freed.
+ */
+function tableArenaScope(module: W2CGeneratedModule) {
+  return tableArenaSize(module)
+    ? 'decltype(tableArena)::Scope tableArenaScope { tableArena };'
+    : '';
+}
+
+export function buildExportBridgeHeader(
+  module: W2CGeneratedModule,
+  instanceLayout?: InstanceField[]
+) {
   const imports = module.importedModules;
   const includes = imports.map((i) => `#include "${i.name}-imports.h"`);
+  const snapshotDecls = instanceLayout
+    ? [
+        'void snapshot(const std::string& path) override;',
+        'void restore(const std::string& path) override;',
+      ]
+    : [];
+  const initialTableMembers = (instanceLayout ?? [])
+    .filter((f) => f.kind === 'funcref-table')
+    .map((f) => `InitialFuncRefTable ${initialTableFieldName(f)};`);
+  const arenaSize = tableArenaSize(module);
 
   return (
     HEADER +
     stripIndent(`
       #pragma once
+      #include <ReactNativePolygen/ModuleContext.h>
+      #include <ReactNativePolygen/ResultBuffer.h>
+      #include <ReactNativePolygen/TableArena.h>
       #include "${module.name}.h"
       ${includes.join('\n      ')}
 
       namespace callstack::polygen::generated {
 
-      class ${module.generatedClassName}ModuleContext: public facebook::jsi::NativeState {
+      /**
+       * Context of a module instance, holding all its state other than memories and growable tables in a single allocation.
+       */
+      class ${module.generatedClassName}ModuleContext: public callstack::polygen::ModuleContext {
       public:
-        ${module.generatedClassName}ModuleContext(facebook::jsi::Runtime& rt, facebook::jsi::Object&& importObject)
+        ${module.generatedClassName}ModuleContext(facebook::jsi::Runtime& rt, facebook::jsi::Object&& importObject, LinkedImports&& linkedImports)
           : importObject(std::move(importObject))
           ${imports.map((i) => `, INIT_IMPORT_CTX(${i.generatedRootContextFieldName}, "${i.name}")`).join('\n        ')}
         {}
+        ~${module.generatedClassName}ModuleContext() override;
+
+        const Module& getModule() const override;
+        void attach(facebook::jsi::Runtime& rt, facebook::jsi::Object& target) override;
+        bool callBatch(size_t exportIndex, std::span<const double> args, std::span<double> results, size_t count) override;
+        void rebindImports(LinkedImports&& linkedImports) override;
+        ${snapshotDecls.join('\n        ')}
 
         facebook::jsi::Object importObject;
         ${module.generatedContextTypeName} rootCtx;
         ${imports.map((i) => `${i.generatedContextTypeName} ${i.generatedRootContextFieldName};`).join('\n      ')}
+        ${module.resultBufferSize > 0 ? `ResultBuffer<${module.resultBufferSize}> resultBuffer;` : ''}
+        ${arenaSize ? `TableArena<${arenaSize}> tableArena;` : ''}
+        ${initialTableMembers.join('\n        ')}
+
+      protected:
+        void instantiateModule() override;
+        void freeModule() override;
       };
 
-      void create${module.generatedClassName}Exports(facebook::jsi::Runtime &rt, facebook::jsi::Object& target, facebook::jsi::Object&& importObject);
+      std::shared_ptr<ModuleContext> create${module.generatedClassName}Context(facebook::jsi::Runtime &rt, facebook::jsi::Object&& importObject, LinkedImports&& linkedImports);
 
       }
 `)
   );
 }
 
+/**
+ * Writes multiple returned values into instance result buffer, returning their count.
+ */
+function writeNativeReturnIntoResultBuffer(varName: string, types: ValueType[]) {
+  const assignments = types.map(
+    (t, i) =>
+      `results[${i}] = ${toDouble(`${varName}.${STRUCT_TYPE_PREFIX[t]}${i}`, t)};`
+  );
+
+  return `auto* results = inst->resultBuffer.values();
+          ${assignments.join('\n          ')}
+          return jsi::Value { ${types.length} }`;
+}
+
 function wrapNativeReturnIntoJSI(varName: string, types: ValueType[]) {
   if (types.length > 1) {
     const elements = types
@@ -66,24 +161,149 @@ function wrapNativeReturnIntoJSI(varName: string, types: ValueType[]) {
   return 'return jsi::Value::undefined()';
 }
 
-export function buildExportBridgeSource(module: W2CGeneratedModule) {
-  function makeExportFunc(func: GeneratedSymbol<GeneratedModuleFunction>) {
+/**
+ * Value types that can be passed through `ExportTrampoline` from `trampolines.h`.
+ */
+const TRAMPOLINE_VALUE_TYPES: ValueType[] = ['i32', 'i64', 'f32', 'f64'];
+
+/**
+ * Checks if specified function can be bridged using signature-specialized trampoline.
+ *
+ * Functions returning multiple values are bridged using a dedicated lambda.
+ */
+function canUseTrampoline(func: GeneratedModuleFunction): boolean {
+  const { parametersTypes, resultTypes } = func;
+  return (
+    resultTypes.length <= 1 &&
+    [...parametersTypes, ...resultTypes].every((t) =>
+      TRAMPOLINE_VALUE_TYPES.includes(t)
+    )
+  );
+}
+
+/**
+ * Checks if exported function can be called in batch, passing values as doubles.
+ *
+ * Functions taking or returning 64-bit integers cannot, as these would lose precision.
+ */
+function canCallInBatch(func: GeneratedModuleFunction): boolean {
+  const { parametersTypes, resultTypes } = func;
+  return (
+    canUseTrampoline(func) &&
+    ![...parametersTypes, ...resultTypes].includes('i64')
+  );
+}
+
+/**
+ * Builds `snapshot()` and `restore()` of the module context, saving every field
+ * of the instance struct generated by wasm2c in order.
+ */
+function buildSnapshotFunctions(
+  module: W2CGeneratedModule,
+  instanceLayout: InstanceField[]
+) {
+  const checksum = [...module.checksum]
+    .map((byte) => `0x${byte.toString(16).padStart(2, '0')}`)
+    .join(', ');
+
+  const unsupported = instanceLayout.find((f) => f.kind === 'unsupported');
+  if (unsupported) {
+    const error = `throw SnapshotError("Instance state '${unsupported.name}' of type ${unsupported.type} cannot be saved");`;
+    return `
+      void ${module.contextClassName}::snapshot(const std::string&) {
+        ${error}
+      }
+
+      void ${module.contextClassName}::restore(const std::string&) {
+        ${error}
+      }
+    `;
+  }
+
+  const writes = instanceLayout.map((f) => {
+    switch (f.kind) {
+      case 'memory':
+        return `writer.writeMemory(rootCtx.${f.name});`;
+      case 'funcref-table':
+        return `writer.writeFuncRefTable(rootCtx.${f.name}, ${initialTableFieldName(f)});`;
+      case 'externref-table':
+        return `writer.writeExternRefTable(rootCtx.${f.name});`;
+      default:
+        return `writer.writeValue<decltype(rootCtx.${f.name})>(rootCtx.${f.name});`;
+    }
+  });
+
+  const reads = instanceLayout.map((f) => {
+    switch (f.kind) {
+      case 'memory':
+        return `reader.readMemory(rootCtx.${f.name});`;
+      case 'funcref-table':
+        return `reader.readFuncRefTable(rootCtx.${f.name}, ${initialTableFieldName(f)});`;
+      case 'externref-table':
+        return `reader.readExternRefTable(rootCtx.${f.name});`;
+      default:
+        return `rootCtx.${f.name} = reader.readValue<decltype(rootCtx.${f.name})>();`;
+    }
+  });
+
+  return `
+      static constexpr ModuleChecksum ${module.generatedClassName}Checksum { ${checksum} };
+
+      void ${module.contextClassName}::snapshot(const std::string& path) {
+        SnapshotWriter writer { ${module.generatedClassName}Checksum };
+        ${writes.join('\n        ')}
+        writer.save(path);
+      }
+
+      void ${module.contextClassName}::restore(const std::string& path) {
+        SnapshotReader reader { path, ${module.generatedClassName}Checksum };
+        ${reads.join('\n        ')}
+      }
+  `;
+}
+
+export function buildExportBridgeSource(
+  module: W2CGeneratedModule,
+  instanceLayout?: InstanceField[]
+) {
+  function makeExportFunc(
+    func: GeneratedSymbol<GeneratedModuleFunction>,
+    exportIndex: number
+  ) {
+    if (canUseTrampoline(func.target)) {
+      return `
+      /* export: '${func.localName}' */
+      case ${exportIndex}:
+        return createExportFunction<${module.contextClassName}>(rt, "${func.localName}", &${func.functionSymbolAccessorName});
+    `;
+    }
+
     const { resultTypes, parameterTypeNames, parametersTypes } = func.target;
 
-    const args = parametersTypes
-      .map((type, i) =>
-        fromJSINumber(`args[${i}]`, type, parameterTypeNames[i]!)
-      )
-      .map((e) => `, ${e}`)
-      .join('');
-    const res = resultTypes.length > 0 ? 'auto res = ' : '';
+    // Arguments are converted before entering the trap boundary, as conversion may throw
+    const argDecls = parametersTypes.map(
+      (type, i) =>
+        `auto arg${i} = ${fromJSINumber(`args[${i}]`, type, parameterTypeNames[i]!)};`
+    );
+    const args = parametersTypes.map((_, i) => `, arg${i}`).join('');
+    const call = `${func.functionSymbolAccessorName}(&inst->rootCtx${args})`;
+    const invocation =
+      resultTypes.length > 0
+        ? `auto res = callWithTrapBoundary([&] { return ${call}; });`
+        : `callWithTrapBoundary([&] { ${call}; });`;
 
     return `
       /* export: '${func.localName}' */
-      exports.setProperty(rt, "${func.localName}", HOSTFN("${func.localName}", ${parameterTypeNames.length}) {
-        ${res}${func.functionSymbolAccessorName}(&inst->rootCtx${args});
-        ${wrapNativeReturnIntoJSI('res', resultTypes)};
-      }));
+      case ${exportIndex}:
+        return HOSTFN("${func.localName}", ${parameterTypeNames.length}) {
+          auto inst = getExportContext<${module.contextClassName}>(rt, thisValue);
+          ${[...argDecls, invocation].join('\n          ')}
+          ${
+            module.usesResultBuffer(func)
+              ? writeNativeReturnIntoResultBuffer('res', resultTypes)
+              : wrapNativeReturnIntoJSI('res', resultTypes)
+          };
+        });
     `;
   }
 
@@ -92,7 +312,7 @@ export function buildExportBridgeSource(module: W2CGeneratedModule) {
       /* exported memory: '${mem.localName}' */
       {
         jsi::Object holder {rt};
-        auto memory = std::make_shared<Memory>(${mem.functionSymbolAccessorName}(&inst->rootCtx));
+        auto memory = std::make_shared<Memory>(${mem.functionSymbolAccessorName}(&inst->rootCtx), inst);
         holder.setNativeState(rt, std::move(memory));
         memories.setProperty(rt, "${mem.localName}", std::move(holder));
       }
@@ -105,23 +325,56 @@ export function buildExportBridgeSource(module: W2CGeneratedModule) {
       /* exported table: '${table.localName}' */
       {
         jsi::Object holder {rt};
-        auto table = std::make_shared<${className}>(${table.functionSymbolAccessorName}(&inst->rootCtx));
+        auto table = std::make_shared<${className}>(${table.functionSymbolAccessorName}(&inst->rootCtx), inst);
         holder.setNativeState(rt, std::move(table));
         tables.setProperty(rt, "${table.localName}", std::move(holder));
       }
     `;
   }
 
-  const initArgs = module.importedModules
-    .map((mod) => `, &inst->${mod.generatedRootContextFieldName}`)
+  const importArgs = module.importedModules
+    .map((mod) => `, &${mod.generatedRootContextFieldName}`)
     .join('');
 
+  const rebindCalls = module.importedModules.map(
+    (mod) =>
+      `${mod.generatedRootContextFieldName}.rebindFunctions(linkedImports.takeModule("${mod.name}"));`
+  );
+  const linkedImportsParam =
+    rebindCalls.length > 0 ? 'LinkedImports&& linkedImports' : 'LinkedImports&&';
+
+  const batchCases = module.exports
+    .map((ex, i) =>
+      ex.target.kind === 'function' &&
+      canCallInBatch(ex.target as GeneratedModuleFunction)
+        ? `
+      /* export: '${ex.localName}' */
+      case ${i}:
+        ExportTrampoline<decltype(${ex.functionSymbolAccessorName})>::invokeBatch(&${ex.functionSymbolAccessorName}, &rootCtx, args, results, count);
+        return true;
+    `
+        : undefined
+    )
+    .filter((c) => c !== undefined);
+
+  const exportFuncCases = module.exports
+    .map((ex, i) =>
+      ex.target.kind === 'function'
+        ? makeExportFunc(ex as GeneratedSymbol<GeneratedModuleFunction>, i)
+        : undefined
+    )
+    .filter((c) => c !== undefined);
+
   return (
     HEADER +
     stripIndent(`
     #include <ReactNativePolygen/gen-utils.h>
+    #include <ReactNativePolygen/trampolines.h>
+    #include <ReactNativePolygen/TrapBoundary.h>
+    #include <ReactNativePolygen/ExportsHostObject.h>
     #include <ReactNativePolygen/WebAssembly.h>
     #include "jsi-exports-bridge.h"
+    #include "static-module.h"
     #include "wasm-rt.h"
     #include "${module.name}.h"
 
@@ -129,14 +382,59 @@ export function buildExportBridgeSource(module: W2CGeneratedModule) {
     using namespace callstack::polygen;
 
     namespace callstack::polygen::generated {
-      void create${module.generatedClassName}Exports(jsi::Runtime &rt, jsi::Object& target, jsi::Object&& importObject) {
-        if (!wasm_rt_is_initialized()) {
-          wasm_rt_init();
+      const Module& ${module.contextClassName}::getModule() const {
+        return *${module.moduleFactoryFunctionName}();
+      }
+
+      bool ${module.contextClassName}::callBatch(size_t exportIndex, std::span<const double> args, std::span<double> results, size_t count) {
+        switch (exportIndex) {
+          ${batchCases.join('\n          ')}
+          default:
+            return false;
+        }
+      }
+
+      void ${module.contextClassName}::rebindImports(${linkedImportsParam}) {
+        ${rebindCalls.join('\n        ')}
+      }
+
+      ${module.contextClassName}::~${module.generatedClassName}ModuleContext() {
+        if (isInstantiated()) {
+          freeModule();
+        }
+      }
+
+      void ${module.contextClassName}::instantiateModule() {
+        ${tableArenaScope(module)}
+        callWithTrapBoundary([&] {
+          wasm2c_${module.mangledName}_instantiate(&rootCtx${importArgs});
+        });
+        ${instanceLayout ? captureInitialTables(instanceLayout) : ''}
+      }
+
+      void ${module.contextClassName}::freeModule() {
+        ${tableArenaScope(module)}
+        wasm2c_${module.mangledName}_free(&rootCtx);
+      }
+      ${instanceLayout ? buildSnapshotFunctions(module, instanceLayout) : ''}
+
+      /**
+       * Creates exported function at specified position in module exports, shared by all instances.
+       */
+      static jsi::Value create${module.generatedClassName}Export(jsi::Runtime &rt, size_t exportIndex) {
+        switch (exportIndex) {
+          ${exportFuncCases.join('\n          ')}
+          default:
+            return jsi::Value::undefined();
         }
+      }
 
-        auto inst = std::make_shared<${module.contextClassName}>(rt, std::move(importObject));
-        wasm2c_${module.mangledName}_instantiate(&inst->rootCtx${initArgs});
+      std::shared_ptr<ModuleContext> create${module.generatedClassName}Context(jsi::Runtime &rt, jsi::Object&& importObject, LinkedImports&& linkedImports) {
+        return std::make_shared<${module.contextClassName}>(rt, std::move(importObject), std::move(linkedImports));
+      }
 
+      void ${module.contextClassName}::attach(jsi::Runtime &rt, jsi::Object& target) {
+        auto inst = std::static_pointer_cast<${module.contextClassName}>(shared_from_this());
         target.setNativeState(rt, inst);
 
         // Memories
@@ -148,12 +446,13 @@ export function buildExportBridgeSource(module: W2CGeneratedModule) {
         jsi::Object tables {rt};
         ${module.exportedTables.map(makeExportTable).join('\n        ')}
         target.setProperty(rt, "tables", std::move(tables));
+        ${module.resultBufferSize > 0 ? 'target.setProperty(rt, "resultBuffer", jsi::ArrayBuffer {rt, std::shared_ptr<jsi::MutableBuffer> {inst, &inst->resultBuffer}});' : ''}
 
-        // Exported functions
-        jsi::Object exports {rt};
-        ${module.exportedFunctions.map(makeExportFunc).join('\n        ')}
-        exports.setNativeState(rt, inst);
-        target.setProperty(rt, "exports", std::move(exports));
+        // Exported functions, created on first access
+        auto mod = ${module.moduleFactoryFunctionName}();
+        auto functions = SharedExportFunctions::forModule(rt, mod->getExports().size(), &create${module.generatedClassName}Export);
+        auto exports = std::make_shared<ExportsHostObject<${module.contextClassName}>>(std::move(mod), inst, std::move(functions));
+        target.setProperty(rt, "exports", jsi::Object::createFromHostObject(rt, std::move(exports)));
       }
     }
   `)
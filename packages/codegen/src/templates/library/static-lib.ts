@@ -37,6 +37,9 @@ export function buildStaticLibrarySource(module: W2CGeneratedModule) {
     'callstack::polygen::StaticLibraryModule'
   );
 
+  const importType = new cpp.TypeBuilder('callstack::polygen::Module::Import');
+  const exportType = new cpp.TypeBuilder('callstack::polygen::Module::Export');
+
   const moduleImports = module.imports
     .values()
     .map((i) =>
@@ -55,6 +58,25 @@ export function buildStaticLibrarySource(module: W2CGeneratedModule) {
       ])
     );
 
+  // Descriptors are constant, so metadata needs no allocations at runtime.
+  // Inner braces initialize the array wrapped by `std::array`
+  const importsVar = new cpp.VariableBuilder('moduleImports')
+    .withType((t) =>
+      t.of(`constexpr std::array<${importType}, ${module.imports.length}>`)
+    )
+    .withInitializer(
+      (i) => i.initializerListOf([...moduleImports], true),
+      true
+    );
+  const exportsVar = new cpp.VariableBuilder('moduleExports')
+    .withType((t) =>
+      t.of(`constexpr std::array<${exportType}, ${module.exports.length}>`)
+    )
+    .withInitializer(
+      (i) => i.initializerListOf([...moduleExports], true),
+      true
+    );
+
   const moduleVar = new cpp.VariableBuilder('moduleInfo')
     .withType(moduleType)
     .withInitializer(
@@ -62,9 +84,9 @@ export function buildStaticLibrarySource(module: W2CGeneratedModule) {
         i.listOf(
           [
             i.string(module.name),
-            i.initializerListOf([...moduleImports]),
-            i.initializerListOf([...moduleExports]),
-            i.symbol(`create${module.generatedClassName}Exports`),
+            i.symbol(importsVar.name),
+            i.symbol(exportsVar.name),
+            i.symbol(`create${module.generatedClassName}Context`),
           ],
           true
         ),
@@ -93,6 +115,8 @@ export function buildStaticLibrarySource(module: W2CGeneratedModule) {
 
   builder.namespace('callstack::polygen::generated', () =>
     builder
+      .defineVariable(importsVar)
+      .defineVariable(exportsVar)
       .defineVariable(moduleVar)
       .defineVariable(moduleSharedVar)
       .defineFunction(moduleGetterFunc)
@@ -0,0 +1,287 @@
+/**
+ * Minimum size of an active data segment compressed in generated source.
+ *
+ * Smaller segments barely affect size of the binary.
+ */
+export const COMPRESSED_DATA_SEGMENT_MIN_SIZE = 4 * 1024;
+
+/**
+ * Maximum size of a compressed data segment, relative to its original size.
+ *
+ * Segments which do not compress well are kept as they are, as decompressing them
+ * costs more than it saves.
+ */
+export const COMPRESSED_DATA_SEGMENT_MAX_RATIO = 0.9;
+
+/**
+ * Size of chunks compressed separately, so that any part of a segment can be
+ * decompressed on its own. Chunks end at multiples of this size in memory.
+ *
+ * Must be kept in sync with `POLYGEN_COMPRESSED_DATA_CHUNK_SIZE` in `wasm-rt-mem-impl.c`.
+ */
+export const COMPRESSED_DATA_CHUNK_SIZE = 64 * 1024;
+
+const MIN_MATCH = 4;
+const LAST_LITERALS = 5;
+const MATCH_FIND_LIMIT = 12;
+const MAX_OFFSET = 65535;
+const HASH_LOG = 16;
+
+const LOAD_DATA_PATTERN =
+  /LOAD_DATA\((.+?), (.+?), (data_segment_data_\w+), (\d+)\);/g;
+
+const COMPRESSED_DATA_DECLARATIONS = `
+/* Data segments decompressed into memories by Polygen */
+void polygen_load_compressed_data(wasm_rt_memory_t* memory, u64 offset, const u8* data, size_t compressed_size, size_t size);
+
+#define POLYGEN_LOAD_COMPRESSED_DATA(m, o, i, cs, s)   \\
+  do {                                                \\
+    RANGE_CHECK((&m), o, s);                          \\
+    polygen_load_compressed_data(&(m), o, i, cs, s);  \\
+  } while (0)
+`;
+
+function hash(sequence: number): number {
+  return Math.imul(sequence, 2654435761) >>> (32 - HASH_LOG);
+}
+
+function writeLength(output: Uint8Array, position: number, length: number) {
+  while (length >= 255) {
+    output[position++] = 255;
+    length -= 255;
+  }
+  output[position++] = length;
+  return position;
+}
+
+function writeLiterals(
+  output: Uint8Array,
+  position: number,
+  literals: Uint8Array,
+  matchLength: number
+) {
+  const literalLength = literals.length;
+  output[position++] =
+    (Math.min(literalLength, 15) << 4) |
+    Math.min(Math.max(matchLength - MIN_MATCH, 0), 15);
+  if (literalLength >= 15) {
+    position = writeLength(output, position, literalLength - 15);
+  }
+
+  output.set(literals, position);
+  return position + literalLength;
+}
+
+/**
+ * Compresses data into a single LZ4 block.
+ *
+ * This is a greedy compressor, finding matches with a single hash table, which is
+ * sufficient for data segments and keeps codegen fast.
+ *
+ * @param input Data to compress
+ */
+export function compressLZ4(input: Uint8Array): Uint8Array {
+  const output = new Uint8Array(
+    input.length + Math.ceil(input.length / 255) + 16
+  );
+  const table = new Int32Array(1 << HASH_LOG).fill(-1);
+  const read32 = (i: number) =>
+    input[i]! |
+    (input[i + 1]! << 8) |
+    (input[i + 2]! << 16) |
+    (input[i + 3]! << 24);
+
+  // Last match must start at least 12 bytes before the end, and the last 5 bytes
+  // are always literals
+  const matchFindLimit = input.length - MATCH_FIND_LIMIT;
+  const matchEndLimit = input.length - LAST_LITERALS;
+
+  let position = 0;
+  let anchor = 0;
+  let ip = 0;
+  while (ip < matchFindLimit) {
+    const sequence = read32(ip);
+    const h = hash(sequence);
+    const candidate = table[h]!;
+    table[h] = ip;
+
+    if (
+      candidate < 0 ||
+      ip - candidate > MAX_OFFSET ||
+      read32(candidate) !== sequence
+    ) {
+      ip++;
+      continue;
+    }
+
+    let start = ip;
+    let reference = candidate;
+    while (
+      start > anchor &&
+      reference > 0 &&
+      input[start - 1] === input[reference - 1]
+    ) {
+      start--;
+      reference--;
+    }
+
+    let end = ip + MIN_MATCH;
+    while (end < matchEndLimit && input[end] === input[candidate + end - ip]) {
+      end++;
+    }
+
+    const matchLength = end - start;
+    position = writeLiterals(
+      output,
+      position,
+      input.subarray(anchor, start),
+      matchLength
+    );
+    output[position++] = (start - reference) & 0xff;
+    output[position++] = (start - reference) >> 8;
+    if (matchLength - MIN_MATCH >= 15) {
+      position = writeLength(output, position, matchLength - MIN_MATCH - 15);
+    }
+
+    anchor = ip = end;
+    if (ip - 2 < matchFindLimit) {
+      table[hash(read32(ip - 2))] = ip - 2;
+    }
+  }
+
+  position = writeLiterals(output, position, input.subarray(anchor), 0);
+  return output.subarray(0, position);
+}
+
+function writeUint32(output: number[], value: number) {
+  output.push(
+    value & 0xff,
+    (value >> 8) & 0xff,
+    (value >> 16) & 0xff,
+    value >>> 24
+  );
+}
+
+/**
+ * Compresses a data segment into chunks, each compressed as a separate LZ4 block.
+ *
+ * Compressed data starts with the size of the first chunk, followed by the chunks,
+ * each prefixed with the size of its compressed block, all as 32-bit little endian
+ * integers.
+ *
+ * @param data Contents of the segment
+ * @param offset Offset of the segment in memory, if it is constant
+ */
+export function compressChunks(
+  data: Uint8Array,
+  offset: number | undefined
+): Uint8Array {
+  const firstChunkSize =
+    COMPRESSED_DATA_CHUNK_SIZE - ((offset ?? 0) % COMPRESSED_DATA_CHUNK_SIZE);
+
+  const output: number[] = [];
+  writeUint32(output, firstChunkSize);
+  for (
+    let start = 0, end = firstChunkSize;
+    start < data.length;
+    start = end, end += COMPRESSED_DATA_CHUNK_SIZE
+  ) {
+    const block = compressLZ4(data.subarray(start, end));
+    writeUint32(output, block.length);
+    for (const byte of block) {
+      output.push(byte);
+    }
+  }
+
+  return Uint8Array.from(output);
+}
+
+function formatBytes(data: Uint8Array): string {
+  let result = '';
+  for (let i = 0; i < data.length; i++) {
+    result += `0x${data[i]!.toString(16).padStart(2, '0')}, `;
+    if ((i + 1) % 12 === 0) {
+      result += '\n';
+    }
+  }
+  if (data.length % 12 !== 0) {
+    result += '\n';
+  }
+  return result;
+}
+
+function parseBytes(source: string): Uint8Array {
+  const matches = source.match(/0x[0-9a-f]{2}/g) ?? [];
+  return Uint8Array.from(matches, (byte) => parseInt(byte, 16));
+}
+
+function countReferences(source: string, name: string): number {
+  return source.match(new RegExp(`\\b${name}\\b`, 'g'))?.length ?? 0;
+}
+
+/**
+ * Rewrites source generated by wasm2c, so that large active data segments are stored
+ * compressed with LZ4 (see {@link compressChunks}), and decompressed straight into memory
+ * when instantiating the module.
+ *
+ * Only segments not referenced by any other code, and compressing to at most
+ * {@link COMPRESSED_DATA_SEGMENT_MAX_RATIO} of their size, are compressed.
+ *
+ * @param source Contents of a C source generated by wasm2c
+ */
+export function compressDataSegments(source: string): string {
+  let result = source;
+  let compressedCount = 0;
+
+  for (const [call, memory, offset, name, size] of source.matchAll(
+    LOAD_DATA_PATTERN
+  )) {
+    const definitionStart = `static const u8 ${name}[] = {\n`;
+    const start = result.indexOf(definitionStart);
+    const end = result.indexOf('\n};', start);
+    if (
+      Number(size) < COMPRESSED_DATA_SEGMENT_MIN_SIZE ||
+      countReferences(source, name!) !== 2 ||
+      start === -1 ||
+      end === -1
+    ) {
+      continue;
+    }
+
+    const data = parseBytes(result.slice(start + definitionStart.length, end));
+    if (data.length !== Number(size)) {
+      continue;
+    }
+
+    const constantOffset = /^\d+u$/.test(offset!)
+      ? parseInt(offset!, 10)
+      : undefined;
+    const compressed = compressChunks(data, constantOffset);
+    if (compressed.length > data.length * COMPRESSED_DATA_SEGMENT_MAX_RATIO) {
+      continue;
+    }
+
+    result =
+      result.slice(0, start) +
+      definitionStart +
+      formatBytes(compressed).replace(/\n$/, '') +
+      result.slice(end);
+    result = result.replace(
+      call,
+      `POLYGEN_LOAD_COMPRESSED_DATA(${memory}, ${offset}, ${name}, ${compressed.length}, ${size});`
+    );
+    compressedCount++;
+  }
+
+  if (compressedCount === 0) {
+    return source;
+  }
+
+  const firstSegment = result.indexOf('static const u8 data_segment_data_');
+  return (
+    result.slice(0, firstSegment) +
+    COMPRESSED_DATA_DECLARATIONS.trimStart() +
+    '\n' +
+    result.slice(firstSegment)
+  );
+}
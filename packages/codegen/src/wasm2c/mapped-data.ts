@@ -0,0 +1,88 @@
+/**
+ * Minimum size of an active data segment mapped into memory instead of copied.
+ *
+ * Smaller segments are cheaper to copy than to map.
+ */
+export const MAPPED_DATA_SEGMENT_MIN_SIZE = 64 * 1024;
+
+/**
+ * Alignment of mapped data segments, the largest page size of supported platforms.
+ *
+ * The runtime maps whole pages of the host, so the segments are aligned to a multiple
+ * of any page size it may run with.
+ */
+export const MAPPED_DATA_SEGMENT_ALIGNMENT = 16384;
+
+const LOAD_DATA_PATTERN =
+  /LOAD_DATA\((.+?), (\d+)u, (data_segment_data_\w+), (\d+)\);/g;
+
+const MAPPED_DATA_DECLARATIONS = `
+/* Data segments mapped copy-on-write into memories by Polygen */
+#if defined(__APPLE__)
+#define POLYGEN_MAPPED_DATA __attribute__((section("__DATA,__polygen_data"), aligned(${MAPPED_DATA_SEGMENT_ALIGNMENT})))
+#else
+#define POLYGEN_MAPPED_DATA __attribute__((aligned(${MAPPED_DATA_SEGMENT_ALIGNMENT})))
+#endif
+
+void polygen_load_mapped_data(wasm_rt_memory_t* memory, u64 offset, const u8* data, size_t size);
+
+#define POLYGEN_LOAD_MAPPED_DATA(m, o, i, s)   \\
+  do {                                        \\
+    RANGE_CHECK((&m), o, s);                  \\
+    polygen_load_mapped_data(&(m), o, i, s);  \\
+  } while (0)
+`;
+
+function countReferences(source: string, name: string): number {
+  return source.match(new RegExp(`\\b${name}\\b`, 'g'))?.length ?? 0;
+}
+
+/**
+ * Rewrites source generated by wasm2c, so that large active data segments are mapped
+ * into memory when instantiating the module, instead of being copied.
+ *
+ * Such segments are aligned to a page, and padded so that the segment is congruent
+ * with its offset in memory modulo page size. This lets the runtime map pages of the
+ * segment straight from the binary, as private copy-on-write pages which stay shared
+ * and clean until written to.
+ *
+ * Only segments with constant offsets, not referenced by any other code, are mapped.
+ *
+ * @param source Contents of a C source generated by wasm2c
+ */
+export function mapDataSegments(source: string): string {
+  const candidates = [...source.matchAll(LOAD_DATA_PATTERN)].filter(
+    ([, , , name, size]) =>
+      Number(size) >= MAPPED_DATA_SEGMENT_MIN_SIZE &&
+      countReferences(source, name!) === 2 &&
+      source.includes(`static const u8 ${name}[] = {`)
+  );
+
+  if (candidates.length === 0) {
+    return source;
+  }
+
+  let result = source;
+  for (const [call, memory, offset, name, size] of candidates) {
+    const padding = Number(offset) % MAPPED_DATA_SEGMENT_ALIGNMENT;
+    const paddedData = padding > 0 ? `[${padding}] = ` : '';
+
+    result = result
+      .replace(
+        `static const u8 ${name}[] = {\n`,
+        `POLYGEN_MAPPED_DATA static const u8 ${name}[] = {\n${paddedData}`
+      )
+      .replace(
+        call,
+        `POLYGEN_LOAD_MAPPED_DATA(${memory}, ${offset}u, ${name} + ${padding}, ${size});`
+      );
+  }
+
+  const firstSegment = result.indexOf('POLYGEN_MAPPED_DATA static const u8');
+  return (
+    result.slice(0, firstSegment) +
+    MAPPED_DATA_DECLARATIONS.trimStart() +
+    '\n' +
+    result.slice(firstSegment)
+  );
+}
@@ -1,6 +1,8 @@
 import fs from 'node:fs/promises';
 import path from 'node:path';
 import { execa } from 'execa';
+import { compressDataSegments } from './compressed-data.js';
+import { mapDataSegments } from './mapped-data.js';
 
 const waToolkitPath = process.env.WABT_PATH;
 let finalWasm2cPath: string | undefined;
@@ -80,6 +82,11 @@ export interface Wasm2cGenerateOptions {
    * Overrides the number of outputs for the module.
    */
   numOutputs?: number;
+
+  /**
+   * Whether large data segments should be stored compressed in generated sources.
+   */
+  compressDataSegments?: boolean;
 }
 
 function getModuleNameFor(
@@ -161,5 +168,22 @@ export async function generateCSources(
     i += 1;
   }
 
+  // Large data segments are either compressed, or mapped into memories by the runtime,
+  // instead of copied
+  const sourceFiles = generatedFiles.filter((file) => file.endsWith('.c'));
+  await Promise.all(
+    sourceFiles.map(async (file) => {
+      const source = await fs.readFile(file, 'utf8');
+      let rewrittenSource = source;
+      if (options?.compressDataSegments) {
+        rewrittenSource = compressDataSegments(rewrittenSource);
+      }
+      rewrittenSource = mapDataSegments(rewrittenSource);
+      if (rewrittenSource !== source) {
+        await fs.writeFile(file, rewrittenSource);
+      }
+    })
+  );
+
   return generatedFiles;
 }
@@ -24,6 +24,8 @@ export function polygenConfig(config: PolygenConfig): ResolvedPolygenConfig {
     directory: output.directory ?? 'node_modules/.polygen-out',
     enableCodegenFileSplit: output.enableCodegenFileSplit ?? true,
     codegenFileSplitThreshold: 100,
+    memoryCheck: output.memoryCheck ?? 'auto',
+    moduleVerification: output.moduleVerification ?? 'strict',
   };
 
   const resolvedScan: ResolvedPolygenScanConfig = {
@@ -15,8 +15,45 @@ export interface PolygenOutputConfig {
    * How much function should be in a single file before splitting.
    */
   codegenFileSplitThreshold?: number;
+
+  /**
+   * How out-of-bounds accesses to WebAssembly memories are detected.
+   *
+   * - `guard-pages` reserves 8 GiB of address space per memory, and relies on guard
+   *   pages to trap out-of-bounds accesses, so loads and stores are not checked.
+   *   Falls back to `bounds-check` on hosts not supporting it (e.g. 32-bit ones).
+   * - `bounds-check` checks every load and store explicitly.
+   * - `auto` uses `wasm2c` runtime defaults.
+   */
+  memoryCheck?: MemoryCheckStrategy;
+
+  /**
+   * How modules loaded from their contents (not from Metro-generated metadata) are verified.
+   *
+   * In every mode, modules are first matched against a cheap fingerprint of each precompiled
+   * module, so ones not matching any module are rejected without being hashed in full.
+   *
+   * - `strict` verifies SHA-256 checksum of the single module matching the fingerprint.
+   * - `cached` verifies the checksum of a module loaded from a file (`Module.fromFile()`) once
+   *   per application version, and records the file in a cache in the application cache directory,
+   *   so later launches loading the same file skip hashing it. The cache is only available on iOS.
+   *   Modules loaded from buffers have no file to be recorded by, so they are always verified,
+   *   the same as with `strict`.
+   * - `fingerprint` accepts the module matching the fingerprint without computing its checksum.
+   */
+  moduleVerification?: ModuleVerificationStrategy;
 }
 
+/**
+ * Strategy of detecting out-of-bounds memory accesses.
+ */
+export type MemoryCheckStrategy = 'auto' | 'guard-pages' | 'bounds-check';
+
+/**
+ * Strategy of verifying modules loaded from their contents.
+ */
+export type ModuleVerificationStrategy = 'strict' | 'cached' | 'fingerprint';
+
 export type ResolvedPolygenOutputConfig = Required<PolygenOutputConfig>;
 
 export interface PolygenScanConfig {
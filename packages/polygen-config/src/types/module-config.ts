@@ -25,6 +25,50 @@ export interface Wasm2CModuleConfig {
    * However, if global option `enableCodegenFileSplit` is set to `false`, this has no effect.
    */
   numOutputs?: number;
+
+  /**
+   * Whether large data segments should be stored LZ4-compressed in generated code, and
+   * decompressed into memory when the module is instantiated.
+   *
+   * This reduces size of the application binary for modules carrying compressible data,
+   * like fonts or dictionaries, at the cost of slower instantiation. Compressed segments
+   * are not mapped copy-on-write from the binary, so each instance has its own copy.
+   *
+   * @defaultValue false
+   */
+  compressDataSegments?: boolean;
+}
+
+/**
+ * JSI bridge configuration for specific WebAssembly module.
+ *
+ * These options are found under the `bridge` key of the module configuration.
+ */
+export interface JSIBridgeModuleConfig {
+  /**
+   * Whether exported functions returning multiple values should write them into a
+   * reusable result buffer, instead of returning a new array on every call.
+   *
+   * Such functions return the number of written values, and the values can be read
+   * from `instance.results` `Float64Array`. The buffer is overwritten by the next call.
+   * Functions returning 64-bit integers keep returning arrays, holding them as `BigInt`.
+   *
+   * Set to `true` to enable for all exported functions, or to a list of export names.
+   *
+   * @defaultValue false
+   */
+  multiValueResultBuffer?: boolean | string[];
+
+  /**
+   * Whether instances of the module can be saved to a snapshot file with `instance.snapshot()`,
+   * and restored with `WebAssembly.Instance.restore()`.
+   *
+   * Instances of such modules keep a copy of their initial table contents, to save tables
+   * independently of function addresses.
+   *
+   * @defaultValue false
+   */
+  snapshot?: boolean;
 }
 
 /**
@@ -36,6 +80,11 @@ export interface PolygenModuleCommonConfig {
    */
   wasm2c?: Wasm2CModuleConfig;
 
+  /**
+   * JSI bridge related configuration for this module.
+   */
+  bridge?: JSIBridgeModuleConfig;
+
   // TODO: WebAssembly feature configuration
 }
 
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <unistd.h>
+
+namespace callstack::polygen::benchmarks {
+
+/**
+ * Keeps the compiler from optimizing away computation of the value.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Runs `operation` `iterations` times in each of several rounds, returning median
+ * duration of a single run in nanoseconds.
+ */
+template <typename TOperation>
+double measure(size_t iterations, TOperation&& operation, size_t rounds = 11) {
+  std::vector<double> durations;
+  durations.reserve(rounds);
+
+  for (size_t round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+      operation();
+    }
+    std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+    durations.push_back(duration.count() / iterations);
+  }
+
+  std::sort(durations.begin(), durations.end());
+  return durations[rounds / 2];
+}
+
+/**
+ * Returns buffer of pseudo-random bytes, the same for every run.
+ */
+inline std::vector<uint8_t> makeRandomData(size_t size) {
+  std::mt19937 random { 42 };
+  std::vector<uint8_t> data(size);
+  for (auto& byte : data) {
+    byte = (uint8_t)random();
+  }
+  return data;
+}
+
+/**
+ * File with specified contents, removed when destroyed.
+ */
+class TemporaryFile {
+public:
+  /**
+   * Creates file filled with pseudo-random bytes.
+   */
+  explicit TemporaryFile(size_t size): TemporaryFile(makeRandomData(size)) {}
+
+  explicit TemporaryFile(std::span<const uint8_t> contents) {
+    auto* directory = std::getenv("TMPDIR");
+    path_ = std::string(directory != nullptr ? directory : "/tmp") + "/polygen-benchmark-XXXXXX";
+
+    int fd = mkstemp(path_.data());
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(), "Failed to create " + path_);
+    }
+
+    auto written = write(fd, contents.data(), contents.size());
+    close(fd);
+    if (written != (ssize_t)contents.size()) {
+      throw std::system_error(errno, std::generic_category(), "Failed to write " + path_);
+    }
+  }
+
+  ~TemporaryFile() {
+    unlink(path_.c_str());
+  }
+
+  TemporaryFile(const TemporaryFile&) = delete;
+  TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+  const std::string& getPath() const {
+    return path_;
+  }
+
+private:
+  std::string path_;
+};
+
+inline void report(const char* name, double value, const char* unit) {
+  std::printf("%-56s %12.2f %s\n", name, value, unit);
+}
+
+}
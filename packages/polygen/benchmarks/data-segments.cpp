@@ -0,0 +1,295 @@
+/*
+ * Instantiation time and resident memory per instance of a module with a 32 MB
+ * data segment, when the segment is copied into memory, as wasm2c does, when
+ * it is mapped copy-on-write from the binary (see `mapped-data.ts` in codegen),
+ * and when it is decompressed from LZ4 chunks (see `compressed-data.ts` in codegen).
+ *
+ * Segments of random bytes, text and mostly zeroed memory are measured, as they
+ * compress very differently. Size of compressed segments is reported against
+ * the original, as that is what compressing them saves in the binary.
+ *
+ * Resident memory is measured after instantiating, after a sparse workload
+ * reading a single byte of every 16th WebAssembly page, and after reading the whole
+ * segment. `data-segments-userfaultfd` runs the same benchmark with segments that
+ * are not mapped populated lazily, when first touched (`POLYGEN_USE_USERFAULTFD`).
+ * The segment is held in a file mapped into memory, standing in for the binary.
+ * File-backed pages are counted for every instance mapping them, though they are
+ * shared by all of them. Resident memory is read from `/proc/self/status`, so it is
+ * only reported on Linux.
+ */
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <sys/mman.h>
+#include <wasm-rt.h>
+#include "benchmark.h"
+
+using namespace callstack::polygen::benchmarks;
+
+extern "C" {
+
+void polygen_load_mapped_data(wasm_rt_memory_t* memory, uint64_t offset, const uint8_t* data, size_t size);
+void polygen_load_compressed_data(wasm_rt_memory_t* memory, uint64_t offset, const uint8_t* data, size_t compressed_size, size_t size);
+
+}
+
+namespace {
+
+constexpr size_t kSegmentSize = 32 << 20;
+constexpr uint64_t kSegmentOffset = 1 << 20;
+constexpr uint64_t kMemoryPages = (kSegmentOffset + kSegmentSize) / 65536 + 1;
+constexpr size_t kInstanceCount = 16;
+constexpr size_t kChunkSize = 64 * 1024;
+constexpr size_t kSparseAccessStride = 16 * 65536;
+
+/**
+ * Compresses data into a single LZ4 block, the same way as `compressLZ4()` in codegen.
+ */
+std::vector<uint8_t> compressLZ4(std::span<const uint8_t> input) {
+  constexpr size_t kMinMatch = 4;
+  constexpr size_t kLastLiterals = 5;
+  constexpr size_t kMatchFindLimit = 12;
+  constexpr size_t kMaxOffset = 65535;
+  constexpr int kHashLog = 16;
+
+  std::vector<uint8_t> output;
+  std::vector<int64_t> table(1 << kHashLog, -1);
+  auto read32 = [&](size_t i) {
+    return (uint32_t)input[i] | (uint32_t)input[i + 1] << 8 | (uint32_t)input[i + 2] << 16 | (uint32_t)input[i + 3] << 24;
+  };
+  auto hash = [](uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashLog);
+  };
+  auto writeLength = [&](size_t length) {
+    for (; length >= 255; length -= 255) {
+      output.push_back(255);
+    }
+    output.push_back((uint8_t)length);
+  };
+  auto writeLiterals = [&](size_t from, size_t to, size_t matchLength) {
+    auto literalLength = to - from;
+    auto matchToken = matchLength > kMinMatch ? std::min<size_t>(matchLength - kMinMatch, 15) : 0;
+    output.push_back((uint8_t)(std::min<size_t>(literalLength, 15) << 4 | matchToken));
+    if (literalLength >= 15) {
+      writeLength(literalLength - 15);
+    }
+    output.insert(output.end(), input.begin() + from, input.begin() + to);
+  };
+
+  // Last match must start at least 12 bytes before the end, and the last 5 bytes
+  // are always literals
+  auto matchFindLimit = input.size() > kMatchFindLimit ? input.size() - kMatchFindLimit : 0;
+  auto matchEndLimit = input.size() > kLastLiterals ? input.size() - kLastLiterals : 0;
+
+  size_t anchor = 0;
+  size_t ip = 0;
+  while (ip < matchFindLimit) {
+    auto sequence = read32(ip);
+    auto h = hash(sequence);
+    auto candidate = table[h];
+    table[h] = (int64_t)ip;
+
+    if (candidate < 0 || ip - candidate > kMaxOffset || read32(candidate) != sequence) {
+      ip++;
+      continue;
+    }
+
+    auto start = ip;
+    auto reference = (size_t)candidate;
+    while (start > anchor && reference > 0 && input[start - 1] == input[reference - 1]) {
+      start--;
+      reference--;
+    }
+
+    auto end = ip + kMinMatch;
+    while (end < matchEndLimit && input[end] == input[candidate + end - ip]) {
+      end++;
+    }
+
+    auto matchLength = end - start;
+    writeLiterals(anchor, start, matchLength);
+    output.push_back((uint8_t)(start - reference));
+    output.push_back((uint8_t)((start - reference) >> 8));
+    if (matchLength - kMinMatch >= 15) {
+      writeLength(matchLength - kMinMatch - 15);
+    }
+
+    anchor = ip = end;
+    if (ip - 2 < matchFindLimit) {
+      table[hash(read32(ip - 2))] = (int64_t)(ip - 2);
+    }
+  }
+
+  writeLiterals(anchor, input.size(), 0);
+  return output;
+}
+
+void writeUint32(std::vector<uint8_t>& output, uint32_t value) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    output.push_back((uint8_t)(value >> shift));
+  }
+}
+
+/**
+ * Compresses a segment into LZ4 chunks, the same way as `compressChunks()` in codegen.
+ */
+std::vector<uint8_t> compressChunks(std::span<const uint8_t> data, uint64_t offset) {
+  size_t firstChunkSize = kChunkSize - offset % kChunkSize;
+
+  std::vector<uint8_t> output;
+  writeUint32(output, firstChunkSize);
+  for (size_t start = 0, end = firstChunkSize; start < data.size(); start = end, end += kChunkSize) {
+    auto block = compressLZ4(data.subspan(start, std::min(end, data.size()) - start));
+    writeUint32(output, block.size());
+    output.insert(output.end(), block.begin(), block.end());
+  }
+  return output;
+}
+
+/**
+ * Returns text made of words picked at random from a small vocabulary.
+ */
+std::vector<uint8_t> makeTextData(size_t size) {
+  std::mt19937 random { 42 };
+  std::vector<std::string> words(1024);
+  for (auto& word : words) {
+    word.resize(3 + random() % 8);
+    for (auto& letter : word) {
+      letter = (char)('a' + random() % 26);
+    }
+  }
+
+  std::vector<uint8_t> data;
+  data.reserve(size);
+  while (data.size() < size) {
+    const auto& word = words[random() % words.size()];
+    data.insert(data.end(), word.begin(), word.end());
+    data.push_back(' ');
+  }
+  data.resize(size);
+  return data;
+}
+
+/**
+ * Returns zeroed memory with a few random bytes in every kilobyte, as in static
+ * structures which are mostly left empty.
+ */
+std::vector<uint8_t> makeSparseData(size_t size) {
+  std::mt19937 random { 42 };
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; i += 1024) {
+    for (int j = 0; j < 16; j++) {
+      data[i + random() % 1024] = (uint8_t)random();
+    }
+  }
+  return data;
+}
+
+struct ResidentMemory {
+  double anonymous;
+  double file;
+};
+
+/**
+ * Returns resident memory of the process in megabytes, or NaN if it is not known.
+ */
+ResidentMemory getResidentMemory() {
+  ResidentMemory memory { NAN, NAN };
+  std::ifstream status { "/proc/self/status" };
+  for (std::string line; std::getline(status, line);) {
+    if (line.starts_with("RssAnon:")) {
+      memory.anonymous = std::stod(line.substr(8)) / 1024;
+    } else if (line.starts_with("RssFile:")) {
+      memory.file = std::stod(line.substr(8)) / 1024;
+    }
+  }
+  return memory;
+}
+
+/**
+ * Reports growth of resident memory per instance.
+ */
+void reportResidentMemory(const std::string& name, const ResidentMemory& before, const ResidentMemory& after) {
+  report((name + ": private memory").c_str(), (after.anonymous - before.anonymous) / kInstanceCount, "MB");
+  report((name + ": file-backed memory").c_str(), (after.file - before.file) / kInstanceCount, "MB");
+}
+
+using LoadFunction = std::function<void (wasm_rt_memory_t& memory)>;
+
+void run(const std::string& name, const uint8_t* segment, const LoadFunction& load) {
+  std::vector<wasm_rt_memory_t> memories(kInstanceCount);
+  auto initial = getResidentMemory();
+
+  auto start = std::chrono::steady_clock::now();
+  for (auto& memory : memories) {
+    wasm_rt_allocate_memory(&memory, kMemoryPages, kMemoryPages, false);
+    load(memory);
+  }
+  std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+  report((name + ": instantiation").c_str(), duration.count() / kInstanceCount, "ms");
+  reportResidentMemory(name, initial, getResidentMemory());
+
+  start = std::chrono::steady_clock::now();
+  for (auto& memory : memories) {
+    uint8_t sum = 0;
+    for (size_t offset = 0; offset < kSegmentSize; offset += kSparseAccessStride) {
+      sum += memory.data[kSegmentOffset + offset];
+    }
+    doNotOptimize(sum);
+  }
+  duration = std::chrono::steady_clock::now() - start;
+  report((name + ": sparse access").c_str(), duration.count() / kInstanceCount, "ms");
+  reportResidentMemory(name + " after sparse access", initial, getResidentMemory());
+
+  for (auto& memory : memories) {
+    if (std::memcmp(memory.data + kSegmentOffset, segment, kSegmentSize) != 0) {
+      throw std::runtime_error("Data segment was not loaded correctly");
+    }
+  }
+  reportResidentMemory(name + " after reading", initial, getResidentMemory());
+
+  for (auto& memory : memories) {
+    wasm_rt_free_memory(&memory);
+  }
+}
+
+void runAll(const std::string& kind, const std::vector<uint8_t>& contents) {
+  TemporaryFile binary { contents };
+  int fd = open(binary.getPath().c_str(), O_RDONLY | O_CLOEXEC);
+  auto* segment = (const uint8_t*)mmap(nullptr, kSegmentSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (segment == MAP_FAILED) {
+    throw std::system_error(errno, std::generic_category(), "Failed to map " + binary.getPath());
+  }
+
+  run(kind + " copied", segment, [&](wasm_rt_memory_t& memory) {
+    std::memcpy(memory.data + kSegmentOffset, segment, kSegmentSize);
+  });
+
+  run(kind + " mapped", segment, [&](wasm_rt_memory_t& memory) {
+    polygen_load_mapped_data(&memory, kSegmentOffset, segment, kSegmentSize);
+  });
+
+  auto compressed = compressChunks({ segment, kSegmentSize }, kSegmentOffset);
+  report((kind + " compressed: size").c_str(), 100.0 * compressed.size() / kSegmentSize, "%");
+  run(kind + " compressed", segment, [&](wasm_rt_memory_t& memory) {
+    polygen_load_compressed_data(&memory, kSegmentOffset, compressed.data(), compressed.size(), kSegmentSize);
+  });
+
+  munmap((void*)segment, kSegmentSize);
+}
+
+}
+
+int main() {
+  wasm_rt_init();
+
+  runAll("random", makeRandomData(kSegmentSize));
+  runAll("text", makeTextData(kSegmentSize));
+  runAll("sparse", makeSparseData(kSegmentSize));
+
+  wasm_rt_free();
+  return 0;
+}
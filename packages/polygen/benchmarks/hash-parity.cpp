@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/*
+ * Checks that the runtime computes the same hashes as codegen, which emits them
+ * into the module bag. Vectors are the same as in codegen `src/__tests__` specs
+ * of `xxhash.ts`, `fingerprint.ts` and `perfect-hash.ts`. Not a benchmark, it
+ * is run by `ctest` and exits with non-zero status on any mismatch.
+ */
+#include <cstdio>
+#include <string_view>
+#include <vector>
+#include <ReactNativePolygen/ModuleBag.h>
+#include <ReactNativePolygen/utils/checksum.h>
+#include <ReactNativePolygen/utils/xxhash.h>
+
+using namespace callstack::polygen;
+
+namespace {
+
+int failures = 0;
+
+void check(const char* name, uint64_t actual, uint64_t expected) {
+  if (actual != expected) {
+    std::printf("%s: expected 0x%016llx, got 0x%016llx\n", name, (unsigned long long)expected, (unsigned long long)actual);
+    failures++;
+  }
+}
+
+/**
+ * Returns bytes following a fixed pattern, the same as `makeData()` in codegen specs.
+ */
+std::vector<uint8_t> makeData(size_t size) {
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; i++) {
+    data[i] = (uint8_t)((i * 131 + 17) % 251);
+  }
+  return data;
+}
+
+/**
+ * Returns a module made of a type section and a code section of specified size,
+ * the same as `makeModule()` in codegen specs.
+ */
+std::vector<uint8_t> makeModule(size_t codeSize) {
+  std::vector<uint8_t> module { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x60, 0x00, 0x00, 0x0a };
+  for (auto value = codeSize;;) {
+    auto byte = (uint8_t)(value & 0x7f);
+    value >>= 7;
+    if (value == 0) {
+      module.push_back(byte);
+      break;
+    }
+    module.push_back(byte | 0x80);
+  }
+
+  auto code = makeData(codeSize);
+  module.insert(module.end(), code.begin(), code.end());
+  return module;
+}
+
+void checkFingerprint(size_t codeSize, const ModuleFingerprint& expected) {
+  auto fingerprint = computeModuleFingerprint(makeModule(codeSize));
+  if (!fingerprint.has_value()) {
+    std::printf("fingerprint of module with %zu bytes of code: rejected\n", codeSize);
+    failures++;
+    return;
+  }
+
+  char name[64];
+  std::snprintf(name, sizeof(name), "fingerprint of module with %zu bytes of code", codeSize);
+  check(name, fingerprint->size, expected.size);
+  check(name, fingerprint->contentHash, expected.contentHash);
+  check(name, fingerprint->layoutHash, expected.layoutHash);
+}
+
+}
+
+int main() {
+  const std::pair<size_t, uint64_t> xxh3Vectors[] = {
+    { 0, 0x2d06800538d394c2 },
+    { 1, 0xf319fe2bdfcdfebd },
+    { 3, 0x783f5bb022906e8d },
+    { 4, 0xecb6b53c1ccb45ed },
+    { 8, 0x44979e978879e887 },
+    { 9, 0x1563c8b0d01c5705 },
+    { 16, 0x85915bb3d4afef90 },
+    { 17, 0x9810c9a1e38ac419 },
+    { 64, 0x941cf66ec32627e0 },
+    { 128, 0xd19b9ef5e7ffe94b },
+    { 129, 0x9c1c3a7f14430ab5 },
+    { 240, 0x84c8f5b8b2191a69 },
+    { 241, 0xccf4c89522b37f0a },
+    { 1024, 0xfcc808dc4130319c },
+    { 10000, 0xe21d547561c7f141 },
+  };
+  for (auto [size, expected] : xxh3Vectors) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "XXH3 of %zu bytes", size);
+    check(name, computeXXH3(makeData(size)), expected);
+  }
+
+  checkFingerprint(100, { 116, 0xf33d2dbbdc9daf7b, 0xe03390663ce24aac });
+  checkFingerprint(100000, { 100018, 0xdc11d5f8fdcfbf1f, 0x31113a6cb0c1ce50 });
+
+  std::string_view name = "example.wasm";
+  std::span<const char> nameKey { name.data(), name.size() };
+  check("key hash with seed 0", hashModuleBagKey(nameKey, 0), 0x15006435);
+  check("key hash with seed 7", hashModuleBagKey(nameKey, 7), 0x2fc38816);
+  check("key hash with seed 0xffffffff", hashModuleBagKey(nameKey, 0xffffffff), 0x28dbb09e);
+  auto binaryKey = makeData(24);
+  check("binary key hash", hashModuleBagKey(std::span<const uint8_t> { binaryKey }, 123456789), 0x41556a2e);
+
+  if (failures != 0) {
+    std::printf("%d hashes differ from codegen\n", failures);
+    return 1;
+  }
+
+  std::printf("All hashes match codegen\n");
+  return 0;
+}
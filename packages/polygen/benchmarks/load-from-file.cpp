@@ -0,0 +1,82 @@
+/*
+ * Peak resident memory and time of identifying a 64 MB module from a file mapped
+ * with `MappedFile`, as `Loader::loadModuleFromFile()` does, compared with reading
+ * the file into a buffer first, as when the module is passed from JavaScript.
+ *
+ * Each way runs in a separate process, so that its peak resident memory can be
+ * measured, and is compared with a process doing nothing.
+ */
+#include <chrono>
+#include <fstream>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <ReactNativePolygen/utils/MappedFile.h>
+#include "benchmark.h"
+
+using namespace callstack::polygen;
+using namespace callstack::polygen::benchmarks;
+
+namespace {
+
+void load(const std::string& mode, const std::string& path) {
+  if (mode == "none") {
+    return;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  if (mode == "buffer") {
+    std::ifstream stream { path, std::ios::binary | std::ios::ate };
+    std::vector<uint8_t> buffer(stream.tellg());
+    stream.seekg(0);
+    stream.read((char*)buffer.data(), (std::streamsize)buffer.size());
+    doNotOptimize(computeSHA256(buffer));
+  } else {
+    MappedFile file { path };
+    doNotOptimize(file.computeSHA256());
+  }
+
+  std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+  report(("time, " + mode).c_str(), duration.count(), "ms");
+}
+
+/**
+ * Runs this benchmark in a new process, returning its peak resident memory in megabytes.
+ */
+double runInProcess(const char* executable, const char* mode, const std::string& path) {
+  std::fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    execl(executable, executable, mode, path.c_str(), (char*)nullptr);
+    _exit(127);
+  }
+
+  int status;
+  struct rusage usage {};
+  if (pid < 0 || wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    throw std::runtime_error(std::string("Benchmark process failed: ") + mode);
+  }
+
+#if defined(__APPLE__)
+  return usage.ru_maxrss / double(1 << 20);
+#else
+  return usage.ru_maxrss / double(1 << 10);
+#endif
+}
+
+}
+
+int main(int argc, char** argv) {
+  if (argc == 3) {
+    load(argv[1], argv[2]);
+    return 0;
+  }
+
+  TemporaryFile module { 64 << 20 };
+  auto baseline = runInProcess(argv[0], "none", module.getPath());
+  for (auto* mode : { "buffer", "file" }) {
+    auto peak = runInProcess(argv[0], mode, module.getPath());
+    report((std::string("peak resident memory over baseline, ") + mode).c_str(), peak - baseline, "MB");
+  }
+
+  return 0;
+}
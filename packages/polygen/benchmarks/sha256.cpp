@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/*
+ * Throughput of SHA-256 used to verify modules loaded from their contents.
+ *
+ * Built twice: `sha256` uses SHA extensions of the processor when available,
+ * and `sha256-portable` only the portable implementation.
+ */
+#include <random>
+#include <vector>
+#include <ReactNativePolygen/utils/checksum.h>
+#include "benchmark.h"
+
+using namespace callstack::polygen;
+using namespace callstack::polygen::benchmarks;
+
+int main() {
+  std::mt19937 random { 42 };
+  std::vector<uint8_t> data(32 << 20);
+  for (auto& byte : data) {
+    byte = (uint8_t)random();
+  }
+
+  for (size_t size : { 4 << 10, 64 << 10, 1 << 20, 32 << 20 }) {
+    std::span<const uint8_t> buffer { data.data(), size };
+    auto iterations = std::max<size_t>(1, (64 << 20) / size);
+    auto duration = measure(iterations, [&] {
+      doNotOptimize(computeSHA256(buffer));
+    }, 5);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "SHA-256 of %zu KB", size >> 10);
+    report(name, size / duration * 1e9 / (1 << 20), "MB/s");
+  }
+
+  return 0;
+}
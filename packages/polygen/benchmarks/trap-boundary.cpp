@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/*
+ * Cost of the trap boundary set up by every export call (see `TrapBoundary.h`),
+ * compared with a plain call, with a boundary saving the signal mask, and with
+ * a C++ exception handler, which the boundary replaced. Also measures the cost of a trap returning to the boundary, compared
+ * with throwing `TrapError` from the trap handler.
+ */
+#include <ReactNativePolygen/TrapBoundary.h>
+#include "benchmark.h"
+
+using namespace callstack::polygen;
+using namespace callstack::polygen::benchmarks;
+
+extern "C" {
+
+// Stand-ins of functions generated by wasm2c
+__attribute__((noinline)) uint32_t benchmark_add(uint32_t a, uint32_t b) {
+  return a + b;
+}
+
+__attribute__((noinline)) uint32_t benchmark_trap(void) {
+  wasm_rt_trap(WASM_RT_TRAP_UNREACHABLE);
+}
+
+}
+
+__attribute__((noinline)) uint32_t benchmarkThrow() {
+  throw TrapError(WASM_RT_TRAP_UNREACHABLE);
+}
+
+int main() {
+  wasm_rt_init();
+
+  constexpr size_t calls = 10'000'000;
+  constexpr size_t traps = 100'000;
+  uint32_t a = 1, b = 2;
+
+  report("call", measure(calls, [&] {
+    doNotOptimize(benchmark_add(a, b));
+  }), "ns");
+
+  report("call with trap boundary", measure(calls, [&] {
+    doNotOptimize(callWithTrapBoundary([&] { return benchmark_add(a, b); }));
+  }), "ns");
+
+  // Boundary saving the signal mask, as `wasm_rt_try()` does
+  report("call with trap boundary saving signal mask", measure(calls / 10, [&] {
+    TrapBoundaryScope scope;
+    if (wasm_rt_try(scope.getJmpBuf()) == WASM_RT_TRAP_NONE) {
+      doNotOptimize(benchmark_add(a, b));
+    }
+  }), "ns");
+
+  report("call with exception handler", measure(calls, [&] {
+    try {
+      doNotOptimize(benchmark_add(a, b));
+    } catch (const TrapError&) {
+      doNotOptimize(0);
+    }
+  }), "ns");
+
+  report("trap with trap boundary", measure(traps, [&] {
+    try {
+      callWithTrapBoundary([&] { return benchmark_trap(); });
+    } catch (const TrapError& trap) {
+      doNotOptimize(trap.type);
+    }
+  }), "ns");
+
+  report("trap with exception thrown by the handler", measure(traps, [&] {
+    try {
+      benchmarkThrow();
+    } catch (const TrapError& trap) {
+      doNotOptimize(trap.type);
+    }
+  }), "ns");
+
+  wasm_rt_free();
+  return 0;
+}
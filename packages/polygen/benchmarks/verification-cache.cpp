@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/*
+ * Time to verify a 32 MB module loaded from a file, as `Loader::findModuleFromFile()`
+ * does after finding it by fingerprint, with and without `VerificationCache`.
+ * The cache is opened again for every load, as it is on every launch.
+ */
+#include <ReactNativePolygen/VerificationCache.h>
+#include "benchmark.h"
+
+using namespace callstack::polygen;
+using namespace callstack::polygen::benchmarks;
+
+int main() {
+  TemporaryFile module { 32 << 20 };
+  auto cachePath = module.getPath() + ".cache";
+
+  const ModuleBagEntry entries[] = {
+    { "benchmark", MappedFile { module.getPath() }.computeSHA256(), {}, nullptr },
+  };
+  static constexpr uint16_t slots[] = { 1 };
+  ModuleBag registry { entries, { 0, slots }, { 0, slots }, ModuleVerification::Cached };
+  const auto& entry = registry.getEntries()[0];
+
+  auto load = [&](bool useCache) {
+    auto cache = useCache ? VerificationCache::open(cachePath, "1.0", registry) : nullptr;
+    MappedFile file { module.getPath() };
+    if (cache != nullptr && cache->isVerified(entry, file.getIdentity())) {
+      return;
+    }
+
+    if (file.computeSHA256() != entry.checksum) {
+      throw std::runtime_error("Checksum of the module does not match");
+    }
+    if (cache != nullptr) {
+      cache->markVerified(entry, file.getIdentity());
+    }
+  };
+
+  report("strict verification", measure(1, [&] { load(false); }) / 1e6, "ms");
+
+  report("cached verification, first launch", measure(1, [&] {
+    unlink(cachePath.c_str());
+    load(true);
+  }) / 1e6, "ms");
+
+  report("cached verification, later launches", measure(1, [&] { load(true); }) / 1e6, "ms");
+
+  unlink(cachePath.c_str());
+  return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <jsi/jsi.h>
+#include <ReactNativePolygen/ModuleContext.h>
+#include <ReactNativePolygen/SharedExportFunctions.h>
+#include <ReactNativePolygen/WebAssembly/Module.h>
+
+namespace callstack::polygen {
+
+/**
+ * Exports object of a module instance, creating exported values on first access.
+ *
+ * Property names are taken from the export list of the module, so creating this object
+ * does not depend on the number of exports. Exported functions are shared by all instances
+ * of the module (see `SharedExportFunctions`), each instance only binds them to an object
+ * holding the instance. Bound functions are cached, as well as any values assigned from JavaScript.
+ *
+ * Exports are the only way to reach memories and tables of the instance from JavaScript, so
+ * instances created lazily are instantiated on first access to any export. Accessing other
+ * properties does not instantiate them.
+ */
+template <typename TContext>
+class ExportsHostObject: public facebook::jsi::HostObject {
+public:
+  ExportsHostObject(std::shared_ptr<Module> module, std::shared_ptr<TContext> inst, std::shared_ptr<SharedExportFunctions> functions)
+    : module_(std::move(module)), inst_(std::move(inst)), functions_(std::move(functions)) {}
+
+  facebook::jsi::Value get(facebook::jsi::Runtime& rt, const facebook::jsi::PropNameID& propName) override {
+    auto name = propName.utf8(rt);
+    auto exportIndex = module_->findExport(name);
+
+    // Other properties, e.g. `then` probed by `await`, must not run the start function
+    if (exportIndex.has_value()) {
+      inst_->ensureInstantiated();
+    }
+
+    if (auto cached = values_.find(name); cached != values_.end()) {
+      return { rt, cached->second };
+    }
+
+    if (!exportIndex.has_value()) {
+      return facebook::jsi::Value::undefined();
+    }
+
+    const auto& sharedFunction = functions_->get(rt, *exportIndex);
+    if (sharedFunction.isUndefined()) {
+      return facebook::jsi::Value::undefined();
+    }
+
+    auto function = sharedFunction.getObject(rt).asFunction(rt);
+    auto bind = function.getPropertyAsFunction(rt, "bind");
+    auto bound = bind.callWithThis(rt, function, getReceiver(rt));
+
+    values_.emplace(std::move(name), facebook::jsi::Value { rt, bound });
+    return bound;
+  }
+
+  void set(facebook::jsi::Runtime& rt, const facebook::jsi::PropNameID& propName, const facebook::jsi::Value& value) override {
+    values_.insert_or_assign(propName.utf8(rt), facebook::jsi::Value { rt, value });
+  }
+
+  std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime& rt) override {
+    const auto& exports = module_->getExports();
+
+    std::vector<facebook::jsi::PropNameID> names;
+    names.reserve(exports.size());
+
+    for (const auto& export_ : exports) {
+      names.push_back(facebook::jsi::PropNameID::forUtf8(rt, (const uint8_t*) export_.name.data(), export_.name.size()));
+    }
+
+    for (const auto& [name, _] : values_) {
+      if (!module_->findExport(name).has_value()) {
+        names.push_back(facebook::jsi::PropNameID::forUtf8(rt, name));
+      }
+    }
+
+    return names;
+  }
+
+  const std::shared_ptr<TContext>& getContext() const {
+    return inst_;
+  }
+
+private:
+  /**
+   * Returns object that shared functions are bound to, holding the instance as native state.
+   */
+  const facebook::jsi::Object& getReceiver(facebook::jsi::Runtime& rt) {
+    if (!receiver_.has_value()) {
+      facebook::jsi::Object receiver {rt};
+      receiver.setNativeState(rt, inst_);
+      receiver_.emplace(std::move(receiver));
+    }
+
+    return *receiver_;
+  }
+
+  std::shared_ptr<Module> module_;
+  std::shared_ptr<TContext> inst_;
+  std::shared_ptr<SharedExportFunctions> functions_;
+  std::optional<facebook::jsi::Object> receiver_;
+  std::unordered_map<std::string, facebook::jsi::Value> values_;
+};
+
+}
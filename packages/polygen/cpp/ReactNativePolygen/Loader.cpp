@@ -7,23 +7,40 @@
 #include "Loader.h"
 #include <fmt/format.h>
 #include <ReactNativePolygen/w2c.h>
+#include <ReactNativePolygen/utils/MappedFile.h>
 
 namespace callstack::polygen {
 
 LoaderError::LoaderError(const std::string& what): std::runtime_error(what) {}
 
 std::shared_ptr<Module> Loader::loadModule(std::span<uint8_t> moduleData) const {
+  return this->findModule(moduleData).factory();
+}
+
+std::shared_ptr<Module> Loader::loadModuleByName(std::string_view name, std::string_view checksum) const {
+  return this->findModuleByName(name, checksum).factory();
+}
+
+std::shared_ptr<Module> Loader::loadModuleFromContents(std::span<uint8_t> moduleData) const {
+  return this->findModuleFromContents(moduleData).factory();
+}
+
+std::shared_ptr<Module> Loader::loadModuleFromFile(const std::string& path) const {
+  return this->findModuleFromFile(path).factory();
+}
+
+const ModuleBagEntry& Loader::findModule(std::span<uint8_t> moduleData) const {
   if (ModuleMetadataView::isMetadata(moduleData)) {
     auto metadata = ModuleMetadataView::fromBuffer(moduleData);
     
-    return this->loadModuleByName(metadata->getName(), metadata->checksum);
+    return this->findModuleByName(metadata->getName(), metadata->checksum);
   }
   else {
-    return this->loadModuleFromContents(moduleData);
+    return this->findModuleFromContents(moduleData);
   }
 }
 
-std::shared_ptr<Module> Loader::loadModuleByName(const std::string& name, const std::string& checksum) const {
+const ModuleBagEntry& Loader::findModuleByName(std::string_view name, std::string_view checksum) const {
   auto* foundModule = registry_.getModule(name);
   
   if (foundModule == nullptr) {
@@ -32,23 +49,68 @@ std::shared_ptr<Module> Loader::loadModuleByName(const std::string& name, const
     };
   }
   
-  if (foundModule->checksum != checksum) {
+  if (foundModule->checksum != parseChecksum(checksum)) {
     throw LoaderError {
       fmt::format("Module checksums for '{}' differ, this means that the precompiled module is different from the one that was generated. Perhaps you forgot to rebuild the project?", name)
     };
   }
   
-  return foundModule->factory();
+  return *foundModule;
 }
 
 
-std::shared_ptr<Module> Loader::loadModuleFromContents(std::span<uint8_t> moduleData) const {
-  auto checksum = computeSHA256(moduleData);
-  if (auto foundModule = registry_.findByChecksum(checksum); foundModule != nullptr) {
-    return foundModule->factory();
+const ModuleBagEntry& Loader::findModuleFromContents(std::span<uint8_t> moduleData) const {
+  auto* foundModule = findModuleByContents(moduleData, [&]() { return computeSHA256(moduleData); }, nullptr);
+  if (foundModule != nullptr) {
+    return *foundModule;
   }
 
   throw LoaderError { "Tried to load an unknown WebAssembly Module from binary buffer. Polygen can only load statically precompilied modules." };
 }
 
+const ModuleBagEntry& Loader::findModuleFromFile(const std::string& path) const {
+  const ModuleBagEntry* foundModule;
+  try {
+    MappedFile file { path };
+    foundModule = findModuleByContents(file.getContents(), [&]() { return file.computeSHA256(); }, &file.getIdentity());
+  } catch (const std::system_error& error) {
+    throw LoaderError { fmt::format("Failed to load WebAssembly Module from file: {}", error.what()) };
+  }
+
+  if (foundModule != nullptr) {
+    return *foundModule;
+  }
+
+  throw LoaderError { fmt::format("Tried to load an unknown WebAssembly Module from file '{}'. Polygen can only load statically precompilied modules.", path) };
+}
+
+const ModuleBagEntry* Loader::findModuleByContents(
+    std::span<uint8_t> moduleData, const std::function<ModuleChecksum()>& computeChecksum, const FileIdentity* file) const {
+  auto fingerprint = computeModuleFingerprint(moduleData);
+  auto* foundModule = fingerprint.has_value() ? registry_.findByFingerprint(*fingerprint) : nullptr;
+  if (foundModule == nullptr) {
+    return nullptr;
+  }
+
+  auto verification = registry_.getVerification();
+  if (verification == ModuleVerification::Fingerprint) {
+    return foundModule;
+  }
+
+  auto* cache = verification == ModuleVerification::Cached && file != nullptr ? verificationCache_.get() : nullptr;
+  if (cache != nullptr && cache->isVerified(*foundModule, *file)) {
+    return foundModule;
+  }
+
+  // Only the single module matching the fingerprint needs to be hashed in full
+  if (computeChecksum() != foundModule->checksum) {
+    return nullptr;
+  }
+
+  if (cache != nullptr) {
+    cache->markVerified(*foundModule, *file);
+  }
+  return foundModule;
+}
+
 }
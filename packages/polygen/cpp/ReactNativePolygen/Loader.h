@@ -6,8 +6,10 @@
  */
 #pragma once
 
+#include <functional>
 #include <ReactNativePolygen/utils/checksum.h>
 #include <ReactNativePolygen/ModuleBag.h>
+#include <ReactNativePolygen/VerificationCache.h>
 
 namespace callstack::polygen {
 
@@ -19,16 +21,54 @@ public:
   explicit LoaderError(const std::string& what);
 };
 
+/**
+ * Finds precompiled modules in the registry.
+ *
+ * Modules can be identified from any thread, while created modules must be used
+ * on the JavaScript thread.
+ */
 class Loader final {
 public:
-  Loader(const ModuleBag& registry): registry_(registry) {}
+  Loader(const ModuleBag& registry, std::shared_ptr<VerificationCache> verificationCache = nullptr)
+    : registry_(registry), verificationCache_(std::move(verificationCache)) {}
   
   std::shared_ptr<Module> loadModule(std::span<uint8_t> moduleData) const;
-  std::shared_ptr<Module> loadModuleByName(const std::string& name, const std::string& checksum) const;
+  std::shared_ptr<Module> loadModuleByName(std::string_view name, std::string_view checksum) const;
   std::shared_ptr<Module> loadModuleFromContents(std::span<uint8_t> moduleData) const;
+
+  /**
+   * Loads module from a file, without copying its contents.
+   *
+   * The file is memory-mapped only for the time needed to identify the module.
+   */
+  std::shared_ptr<Module> loadModuleFromFile(const std::string& path) const;
+
+  /**
+   * Identifies module from its contents or Metro-generated metadata, without creating it.
+   *
+   * Throws `LoaderError` if no precompiled module matches.
+   */
+  const ModuleBagEntry& findModule(std::span<uint8_t> moduleData) const;
+  const ModuleBagEntry& findModuleByName(std::string_view name, std::string_view checksum) const;
+  const ModuleBagEntry& findModuleFromContents(std::span<uint8_t> moduleData) const;
+  const ModuleBagEntry& findModuleFromFile(const std::string& path) const;
   
 private:
+  /**
+   * Finds module matching the contents, verifying its checksum as configured.
+   *
+   * `computeChecksum` is called only for the single module matching the fingerprint.
+   * Verification cache is only used for contents of a file, identified by `file`, so
+   * buffers are always hashed in full.
+   */
+  const ModuleBagEntry* findModuleByContents(
+    std::span<uint8_t> moduleData,
+    const std::function<ModuleChecksum()>& computeChecksum,
+    const FileIdentity* file
+  ) const;
+
   const ModuleBag& registry_;
+  std::shared_ptr<VerificationCache> verificationCache_;
 };
 
 }
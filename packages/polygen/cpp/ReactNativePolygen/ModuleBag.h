@@ -6,67 +6,134 @@
  */
 #pragma once
 
-#include <initializer_list>
-#include <tuple>
-#include <unordered_map>
-#include <optional>
-#include <vector>
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
 #include <ReactNativePolygen/WebAssembly/Module.h>
+#include <ReactNativePolygen/utils/checksum.h>
 
 namespace callstack::polygen {
 
-using ModuleFactoryFunction = std::function<std::shared_ptr<Module>()>;
+using ModuleFactoryFunction = std::shared_ptr<Module> (*)();
 
 struct ModuleBagEntry {
-  std::string name;
-  std::string checksum;
+  std::string_view name;
+  ModuleChecksum checksum;
+  ModuleFingerprint fingerprint;
   ModuleFactoryFunction factory;
-  
-  ModuleBagEntry(std::string&& name, std::string&& checksum, ModuleFactoryFunction&& factory)
-  : name(std::move(name)), checksum(std::move(checksum)), factory(std::move(factory)) {}
 };
 
+/**
+ * How modules loaded from their contents are verified.
+ */
+enum class ModuleVerification {
+  /**
+   * Module matching the fingerprint is accepted without computing its checksum.
+   */
+  Fingerprint,
+
+  /**
+   * Checksum of the module matching the fingerprint is verified.
+   */
+  Strict,
+
+  /**
+   * Checksum of the module matching the fingerprint is verified once per application version,
+   * and recorded in `VerificationCache`.
+   */
+  Cached,
+};
+
+/**
+ * Computes seeded 32-bit FNV-1a hash of a module bag key.
+ *
+ * Must be kept in sync with `hashKey()` in codegen `helpers/perfect-hash.ts`.
+ */
+template <typename TByte>
+constexpr uint32_t hashModuleBagKey(std::span<const TByte> key, uint32_t seed) {
+  uint32_t hash = 0x811c9dc5u ^ seed;
+  for (auto byte : key) {
+    hash = (hash ^ (uint8_t)byte) * 0x01000193u;
+  }
+  return hash;
+}
+
+/**
+ * Perfect hash table over module bag entries, generated by codegen.
+ *
+ * Slots hold index of the entry increased by one, or zero for empty slots.
+ * Number of slots is always a power of two.
+ */
+struct ModuleBagIndex {
+  uint32_t seed;
+  std::span<const uint16_t> slots;
+
+  template <typename TByte>
+  constexpr size_t find(std::span<const TByte> key) const {
+    auto slot = hashModuleBagKey(key, seed) & (slots.size() - 1);
+    return slots[slot];
+  }
+};
+
+/**
+ * Registry of all precompiled modules.
+ *
+ * The registry is emitted by codegen as a constant, so it needs no initialization
+ * at runtime. Lookups by name or checksum take constant time and do not allocate.
+ */
 class ModuleBag final {
 public:
-  explicit ModuleBag(std::initializer_list<ModuleBagEntry> items) {
-    moduleNames_.reserve(items.size());
-    
-    for (auto& item : items) {
-      moduleNames_.push_back(item.name);
-      entryMap_.insert({ item.name, item });
-    }
-  }
-  
-  const std::vector<std::string>& getModuleNames() const {
-    return moduleNames_;
+  constexpr ModuleBag(
+    std::span<const ModuleBagEntry> entries,
+    ModuleBagIndex nameIndex,
+    ModuleBagIndex fingerprintIndex,
+    ModuleVerification verification
+  ) : entries_(entries), nameIndex_(nameIndex), fingerprintIndex_(fingerprintIndex), verification_(verification) {}
+
+  std::span<const ModuleBagEntry> getEntries() const {
+    return entries_;
   }
-  
-  const ModuleBagEntry* getModule(const std::string& name) const {
-    auto entry = entryMap_.find(name);
-    
-    if (entry == entryMap_.end()) {
+
+  const ModuleBagEntry* getModule(std::string_view name) const {
+    auto* entry = getEntry(nameIndex_.find<char>(name));
+    if (entry == nullptr || entry->name != name) {
       return nullptr;
     }
-    
-    return &entry->second;
+
+    return entry;
   }
-  
-  const ModuleBagEntry* findByChecksum(const std::string& checksum) const {
-    for (auto& entry : entryMap_) {
-      if (entry.second.checksum == checksum) {
-        return &entry.second;
-      }
+
+  /**
+   * Finds the only module that can match the fingerprint.
+   *
+   * The fingerprint is hashed as its in-memory representation, which on all supported
+   * (little-endian) targets matches the key used by codegen.
+   */
+  const ModuleBagEntry* findByFingerprint(const ModuleFingerprint& fingerprint) const {
+    auto key = std::as_bytes(std::span { &fingerprint, 1 });
+    auto* entry = getEntry(fingerprintIndex_.find<std::byte>(key));
+    if (entry == nullptr || entry->fingerprint != fingerprint) {
+      return nullptr;
     }
-    
-    return nullptr;
+
+    return entry;
+  }
+
+  ModuleVerification getVerification() const {
+    return verification_;
   }
-  
+
 private:
-  std::vector<std::string> moduleNames_;
-  // We ensure that map is created on creation and not changed since
-  // because of that we can return pointer to items and addresses
-  // should not change
-  std::unordered_map<std::string, ModuleBagEntry> entryMap_;
+  const ModuleBagEntry* getEntry(size_t slotValue) const {
+    return slotValue == 0 ? nullptr : &entries_[slotValue - 1];
+  }
+
+  std::span<const ModuleBagEntry> entries_;
+  ModuleBagIndex nameIndex_;
+  ModuleBagIndex fingerprintIndex_;
+  ModuleVerification verification_;
 };
 
 }
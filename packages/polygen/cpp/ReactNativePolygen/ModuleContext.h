@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <jsi/jsi.h>
+#include <ReactNativePolygen/Snapshot.h>
+#include <ReactNativePolygen/WebAssembly/Module.h>
+
+namespace callstack::polygen {
+
+/**
+ * Thrown when buffers or number of calls passed to a batch call are not valid.
+ */
+class BatchCallError: public std::runtime_error {
+public:
+  explicit BatchCallError(const std::string& what): std::runtime_error(what) {}
+};
+
+/**
+ * Base class of generated module instance contexts.
+ *
+ * Provides access to the instance for code not generated for a specific module.
+ */
+class ModuleContext: public facebook::jsi::NativeState, public std::enable_shared_from_this<ModuleContext> {
+public:
+  virtual ~ModuleContext() {}
+
+  /**
+   * Allocates memories and tables of the instance, initializes them and calls the start function.
+   *
+   * Does not access JavaScript values other than through imports, so it may be called on
+   * any thread, as long as imports are dispatched to the JS thread (see `ImportDispatchScope`).
+   */
+  void instantiate() {
+    instantiateModule();
+    instantiated_ = true;
+  }
+
+  /**
+   * Instantiates an instance created lazily, once its exports, memories or tables are first used.
+   *
+   * If instantiating fails, e.g. when the start function traps, the instance stays unusable
+   * and the same exception is thrown on every use.
+   */
+  void ensureInstantiated() {
+    if (instantiated_) [[likely]] {
+      return;
+    }
+    if (instantiationError_) {
+      std::rethrow_exception(instantiationError_);
+    }
+
+    try {
+      instantiate();
+    } catch (...) {
+      instantiationError_ = std::current_exception();
+      throw;
+    }
+  }
+
+  bool isInstantiated() const {
+    return instantiated_;
+  }
+
+  /**
+   * Exposes the instantiated instance to JavaScript, setting it as native state of `target`,
+   * along with its exports, memories and tables.
+   */
+  virtual void attach(facebook::jsi::Runtime& rt, facebook::jsi::Object& target) = 0;
+
+  /**
+   * Returns the module this is an instance of.
+   */
+  virtual const Module& getModule() const = 0;
+
+  /**
+   * Calls exported function at specified position in `Module::getExports()` `count` times.
+   *
+   * Arguments of consecutive calls are read from `args` and results are written to `results`,
+   * both laid out one call after another.
+   *
+   * Returns false if the export is not a function, or cannot be called in batch.
+   */
+  virtual bool callBatch(size_t exportIndex, std::span<const double> args, std::span<double> results, size_t count) = 0;
+
+  /**
+   * Replaces imported functions with ones linked from another import object by `Module::link()`.
+   *
+   * Imported functions are resolved only once, when the instance is created, so this is the only
+   * way to change functions called by the module afterwards. Imported memories, tables and globals
+   * stay the ones the instance was created with.
+   */
+  virtual void rebindImports(LinkedImports&& linkedImports) = 0;
+
+  /**
+   * Resets the instance to the state of a newly created one.
+   *
+   * Memories, tables and globals are initialized again and the start function is called,
+   * while imports stay linked. Memory reservations of the instance are reused by the runtime.
+   * If instantiating again fails, the instance stays unusable, same as with `ensureInstantiated()`.
+   */
+  void reset() {
+    // Freed instance must not be freed again, even if instantiating it again fails
+    instantiated_ = false;
+    freeModule();
+    ensureInstantiated();
+  }
+
+  /**
+   * Saves memories, globals and tables defined by the module to a snapshot file at specified path.
+   *
+   * Only modules generated with `bridge.snapshot` option enabled support snapshots.
+   */
+  virtual void snapshot(const std::string&) {
+    throw SnapshotError("Module was not generated with snapshot support");
+  }
+
+  /**
+   * Restores state saved by `snapshot()` into this instance, which must not have been used yet.
+   */
+  virtual void restore(const std::string&) {
+    throw SnapshotError("Module was not generated with snapshot support");
+  }
+
+protected:
+  /**
+   * Instantiates the module generated by wasm2c, see `instantiate()`.
+   */
+  virtual void instantiateModule() = 0;
+
+  /**
+   * Frees memories and tables of the module instantiated by `instantiateModule()`.
+   */
+  virtual void freeModule() = 0;
+
+private:
+  bool instantiated_ = false;
+  std::exception_ptr instantiationError_;
+};
+
+}
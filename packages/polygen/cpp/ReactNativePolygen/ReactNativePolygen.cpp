@@ -4,24 +4,307 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  */
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <span>
+#include <variant>
+#include <ReactCommon/TurboModuleUtils.h>
+#include <react/bridging/LongLivedObject.h>
 
 #include "ReactNativePolygen.h"
 #include "bridge.h"
+#include "ModuleContext.h"
 #include "NativeStateHelper.h"
+#include "TrapBoundary.h"
 
 using namespace callstack::polygen;
 
 namespace facebook::react {
-    ReactNativePolygen::ReactNativePolygen(std::shared_ptr<CallInvoker> jsInvoker)
+    struct LoaderShutdownSignal {
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool shuttingDown = false;
+    };
+
+    namespace {
+        /**
+         * Returns view of the memory of specified `Float64Array`.
+         *
+         * Throws if the object is not a `Float64Array`, or its view does not fit in its buffer.
+         */
+        std::span<double> getFloat64ArrayView(jsi::Runtime &rt, const jsi::Object &typedArray, const char *name) {
+            auto float64ArrayClass = rt.global().getPropertyAsFunction(rt, "Float64Array");
+            if (!typedArray.instanceOf(rt, float64ArrayClass)) {
+                throw BatchCallError{std::string{name} + " must be a Float64Array"};
+            }
+
+            auto buffer = typedArray.getPropertyAsObject(rt, "buffer").getArrayBuffer(rt);
+            auto byteOffset = typedArray.getProperty(rt, "byteOffset").asNumber();
+            auto length = typedArray.getProperty(rt, "length").asNumber();
+            auto bufferSize = (double) buffer.size(rt);
+            if (byteOffset < 0 || length < 0 || (uint64_t) byteOffset % sizeof(double) != 0 ||
+                byteOffset + length * sizeof(double) > bufferSize) {
+                throw BatchCallError{std::string{name} + " does not fit in its buffer"};
+            }
+
+            return {(double *) (buffer.data(rt) + (size_t) byteOffset), (size_t) length};
+        }
+
+        /**
+         * Returns number of calls of a batch, throwing if it is not a non-negative integer.
+         */
+        size_t getBatchCallCount(double count) {
+            if (!std::isfinite(count) || count < 0 || count != std::trunc(count) ||
+                count > (double) std::numeric_limits<uint32_t>::max()) {
+                throw BatchCallError{"Number of calls must be a non-negative integer"};
+            }
+
+            return (size_t) count;
+        }
+
+        /**
+         * Maximum number of threads identifying modules loaded in batch, and instantiating modules.
+         */
+        constexpr unsigned kMaxLoaderThreads = 4;
+
+        /**
+         * State of modules loaded in batch, shared between the JS thread and loader threads.
+         *
+         * JSI values are only touched on the JS thread, and are released there once all
+         * modules are identified.
+         */
+        struct ModuleBatchLoad {
+            explicit ModuleBatchLoad(size_t count)
+                : inputs(count), entries(count), errors(count), remaining(count) {}
+
+            std::vector<std::variant<std::span<uint8_t>, std::string>> inputs;
+            std::vector<const ModuleBagEntry *> entries;
+            std::vector<std::optional<std::string>> errors;
+            std::atomic<size_t> remaining;
+
+            std::vector<jsi::Object> holders;
+            std::vector<jsi::Value> sources;
+            std::shared_ptr<Promise> promise;
+        };
+
+        /**
+         * State of a module instance created on a loader thread.
+         *
+         * JSI values are only touched on the JS thread, and are released there once the
+         * instance is instantiated.
+         */
+        struct ModuleInstanceCreation {
+            ModuleInstanceCreation(std::shared_ptr<ModuleContext> instance, jsi::Object holder)
+                : instance(std::move(instance)), holder(std::move(holder)) {}
+
+            std::shared_ptr<ModuleContext> instance;
+            std::optional<jsi::Object> holder;
+            std::shared_ptr<Promise> promise;
+            std::exception_ptr error;
+        };
+
+        /**
+         * Values cached for a module, kept alive as long as the runtime they were created in.
+         */
+        struct ModuleRuntimeCacheHolder : public LongLivedObject {
+            explicit ModuleRuntimeCacheHolder(jsi::Runtime &rt) : LongLivedObject(rt) {}
+
+            ModuleRuntimeCache cache;
+        };
+
+        /**
+         * Creates JavaScript error with `LinkError` name, converted to `WebAssembly.LinkError` by the caller.
+         */
+        jsi::JSError makeLinkError(jsi::Runtime &rt, const LinkError &linkError) {
+            auto errorConstructor = rt.global().getPropertyAsFunction(rt, "Error");
+            auto error = errorConstructor.callAsConstructor(rt, linkError.what()).getObject(rt);
+            error.setProperty(rt, "name", "LinkError");
+            return jsi::JSError{rt, jsi::Value{std::move(error)}};
+        }
+
+        /**
+         * Rejects promise with exception thrown while creating a module instance.
+         *
+         * JavaScript errors, e.g. thrown by imports called by the start function, are passed as they are.
+         */
+        void rejectWithException(jsi::Runtime &rt, Promise &promise, std::exception_ptr exception) {
+            try {
+                std::rethrow_exception(std::move(exception));
+            } catch (jsi::JSError &jsError) {
+                promise.reject_.call(rt, jsError.value());
+            } catch (const std::exception &error) {
+                promise.reject(error.what());
+            }
+        }
+
+        /**
+         * Creates dispatcher running imports on the JS thread, blocking the calling thread until they complete.
+         *
+         * Calls scheduled after the runtime is torn down never run, so waiting for a call not started yet
+         * fails once the module is destroyed.
+         */
+        ImportDispatcher makeJSThreadImportDispatcher(std::shared_ptr<CallInvoker> jsInvoker,
+                                                      std::shared_ptr<LoaderShutdownSignal> shutdownSignal) {
+            return [jsInvoker = std::move(jsInvoker), shutdownSignal = std::move(shutdownSignal)](
+                const std::function<void()> &call) {
+                // Shared with the scheduled call, which may still run after this thread stopped waiting
+                struct DispatchedCall {
+                    const std::function<void()> *call;
+                    bool started = false;
+                    bool completed = false;
+                    bool abandoned = false;
+                    std::exception_ptr exception;
+                };
+                auto dispatched = std::make_shared<DispatchedCall>();
+                dispatched->call = &call;
+
+                jsInvoker->invokeAsync([dispatched, shutdownSignal](jsi::Runtime &) {
+                    {
+                        std::lock_guard lock(shutdownSignal->mutex);
+                        if (dispatched->abandoned) {
+                            return;
+                        }
+                        dispatched->started = true;
+                    }
+
+                    try {
+                        (*dispatched->call)();
+                    } catch (...) {
+                        dispatched->exception = std::current_exception();
+                    }
+
+                    std::lock_guard lock(shutdownSignal->mutex);
+                    dispatched->completed = true;
+                    shutdownSignal->condition.notify_all();
+                });
+
+                std::unique_lock lock(shutdownSignal->mutex);
+                shutdownSignal->condition.wait(lock, [&]() {
+                    return dispatched->completed || (shutdownSignal->shuttingDown && !dispatched->started);
+                });
+                if (!dispatched->completed) {
+                    dispatched->abandoned = true;
+                    throw std::runtime_error("Polygen was destroyed while instantiating module on a loader thread");
+                }
+                if (dispatched->exception) {
+                    std::rethrow_exception(dispatched->exception);
+                }
+            };
+        }
+
+        /**
+         * Returns values cached for the module in the runtime, creating them on first use.
+         */
+        ModuleRuntimeCache &getModuleRuntimeCache(jsi::Runtime &rt, const Module &mod) {
+            if (auto cached = mod.getRuntimeCache(rt)) {
+                return *cached;
+            }
+
+            // Released by React Native when the runtime is torn down, which expires the cached entry
+            auto holder = std::make_shared<ModuleRuntimeCacheHolder>(rt);
+            LongLivedObjectCollection::get(rt).add(holder);
+            mod.setRuntimeCache(rt, std::shared_ptr<ModuleRuntimeCache>{holder, &holder->cache});
+            return holder->cache;
+        }
+
+        /**
+         * Creates object describing imports and exports of the module.
+         */
+        jsi::Object buildModuleMetadata(jsi::Runtime &rt, const std::shared_ptr<Module> &mod,
+                                        const std::shared_ptr<CallInvoker> &jsInvoker) {
+            auto imports = mod->getImports();
+            auto exports = mod->getExports();
+
+            std::vector<NativeImportDescriptor> importsMapped;
+            std::vector<NativeExportDescriptor> exportsMapped;
+
+            importsMapped.reserve(imports.size());
+            exportsMapped.reserve(exports.size());
+
+            for (auto &import_: imports) {
+                importsMapped.push_back({std::string{import_.module}, std::string{import_.name},
+                                         static_cast<NativeSymbolKind>(import_.kind)});
+            }
+
+            for (auto &export_: exports) {
+                exportsMapped.push_back({std::string{export_.name}, static_cast<NativeSymbolKind>(export_.kind)});
+            }
+
+            NativeModuleMetadata result{importsMapped, exportsMapped};
+            return bridging::toJs(rt, result, jsInvoker);
+        }
+
+        /**
+         * Freezes module metadata, along with its descriptor arrays and descriptors.
+         */
+        void freezeModuleMetadata(jsi::Runtime &rt, const jsi::Object &metadata) {
+            auto freeze = rt.global().getPropertyAsObject(rt, "Object").getPropertyAsFunction(rt, "freeze");
+            for (auto *name: {"imports", "exports"}) {
+                auto descriptors = metadata.getPropertyAsObject(rt, name).getArray(rt);
+                for (size_t i = 0; i < descriptors.size(rt); i++) {
+                    freeze.call(rt, descriptors.getValueAtIndex(rt, i));
+                }
+                freeze.call(rt, descriptors);
+            }
+            freeze.call(rt, metadata);
+        }
+
+        /**
+         * Returns metadata of the module, built once per runtime.
+         *
+         * The same object is returned for every load of the module, so it is frozen to keep
+         * changes made through one `WebAssembly.Module` from affecting others.
+         */
+        jsi::Object getCachedModuleMetadata(jsi::Runtime &rt, const std::shared_ptr<Module> &mod,
+                                            const std::shared_ptr<CallInvoker> &jsInvoker) {
+            auto &cache = getModuleRuntimeCache(rt, *mod);
+            if (!cache.metadata.has_value()) {
+                auto metadata = buildModuleMetadata(rt, mod, jsInvoker);
+                freezeModuleMetadata(rt, metadata);
+                cache.metadata.emplace(std::move(metadata));
+            }
+
+            return jsi::Value{rt, *cache.metadata}.getObject(rt);
+        }
+
+        /**
+         * Opens verification cache, if the registry was generated to use one.
+         */
+        std::shared_ptr<VerificationCache> openVerificationCache(
+            const ModuleBag &registry, const std::optional<VerificationCacheOptions> &options) {
+            if (!options.has_value() || registry.getVerification() != ModuleVerification::Cached) {
+                return nullptr;
+            }
+
+            return VerificationCache::open(options->path, options->appVersion, registry);
+        }
+    }
+
+    ReactNativePolygen::ReactNativePolygen(
+        std::shared_ptr<CallInvoker> jsInvoker, std::optional<VerificationCacheOptions> verificationCacheOptions)
         : NativePolygenCxxSpecJSI(std::move(jsInvoker))
+        , shutdownSignal_(std::make_shared<LoaderShutdownSignal>())
         , moduleRegistry_(generated::getModuleBag())
-        , moduleLoader_(moduleRegistry_) {
+        , moduleLoader_(moduleRegistry_, openVerificationCache(moduleRegistry_, verificationCacheOptions)) {
         wasm_rt_init();
     }
 
     ReactNativePolygen::~ReactNativePolygen() {
+        // Wakes loader threads waiting for the JS thread, so that destroying the pool does not wait forever
+        {
+            std::lock_guard lock(shutdownSignal_->mutex);
+            shutdownSignal_->shuttingDown = true;
+        }
+        shutdownSignal_->condition.notify_all();
+
+        // Queued instantiations may still trap, so they must finish before signal handlers are removed
+        loaderPool_.reset();
         wasm_rt_free();
     }
 
@@ -42,31 +325,248 @@ namespace facebook::react {
         try {
             auto mod = moduleLoader_.loadModule(bufferView);
             NativeStateHelper::attach(rt, holder, mod);
-            return buildModuleMetadata(rt, mod);
+            return getCachedModuleMetadata(rt, mod, jsInvoker_);
         } catch (const LoaderError &loaderError) {
             throw jsi::JSError(rt, loaderError.what());
         }
     }
 
+    jsi::Object ReactNativePolygen::loadModuleFromFile(jsi::Runtime &rt, jsi::Object holder, jsi::String path) {
+        try {
+            auto mod = moduleLoader_.loadModuleFromFile(path.utf8(rt));
+            NativeStateHelper::attach(rt, holder, mod);
+            return getCachedModuleMetadata(rt, mod, jsInvoker_);
+        } catch (const LoaderError &loaderError) {
+            throw jsi::JSError(rt, loaderError.what());
+        }
+    }
+
+    jsi::Value ReactNativePolygen::loadModules(jsi::Runtime &rt, jsi::Array holders, jsi::Array sources) {
+        auto count = sources.size(rt);
+        if (holders.size(rt) != count) {
+            throw jsi::JSError(rt, "Number of module holders and sources differ");
+        }
+
+        // Buffers are kept alive by holding their values until the batch completes
+        auto batch = std::make_shared<ModuleBatchLoad>(count);
+        for (size_t i = 0; i < count; i++) {
+            auto source = sources.getValueAtIndex(rt, i);
+            if (source.isString()) {
+                batch->inputs[i] = source.getString(rt).utf8(rt);
+            } else {
+                auto buffer = source.asObject(rt).getArrayBuffer(rt);
+                batch->inputs[i] = std::span<uint8_t>{buffer.data(rt), buffer.size(rt)};
+            }
+            batch->holders.push_back(holders.getValueAtIndex(rt, i).asObject(rt));
+            batch->sources.push_back(std::move(source));
+        }
+
+        // Tasks may outlive this module, so they only capture shared state
+        auto &pool = getLoaderPool();
+        auto loader = moduleLoader_;
+        auto jsInvoker = jsInvoker_;
+        return createPromiseAsJSIValue(rt, [&pool, loader, jsInvoker, batch](jsi::Runtime &rt, std::shared_ptr<Promise> promise) {
+            batch->promise = std::move(promise);
+
+            auto complete = [jsInvoker, batch](jsi::Runtime &rt) {
+                auto holders = std::move(batch->holders);
+                auto sources = std::move(batch->sources);
+                auto promise = std::move(batch->promise);
+
+                for (auto &error: batch->errors) {
+                    if (error.has_value()) {
+                        promise->reject(*error);
+                        return;
+                    }
+                }
+
+                jsi::Array result{rt, batch->entries.size()};
+                for (size_t i = 0; i < batch->entries.size(); i++) {
+                    auto mod = batch->entries[i]->factory();
+                    NativeStateHelper::attach(rt, holders[i], mod);
+                    result.setValueAtIndex(rt, i, getCachedModuleMetadata(rt, mod, jsInvoker));
+                }
+                promise->resolve(jsi::Value{std::move(result)});
+            };
+
+            if (batch->inputs.empty()) {
+                complete(rt);
+                return;
+            }
+
+            for (size_t i = 0; i < batch->inputs.size(); i++) {
+                pool.submit([loader, jsInvoker, batch, complete, i]() {
+                    try {
+                        if (auto *path = std::get_if<std::string>(&batch->inputs[i])) {
+                            batch->entries[i] = &loader.findModuleFromFile(*path);
+                        } else {
+                            batch->entries[i] = &loader.findModule(std::get<std::span<uint8_t>>(batch->inputs[i]));
+                        }
+                    } catch (const LoaderError &loaderError) {
+                        batch->errors[i] = loaderError.what();
+                    }
+
+                    if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        jsInvoker->invokeAsync(std::move(complete));
+                    }
+                });
+            }
+        });
+    }
+
+    ThreadPool &ReactNativePolygen::getLoaderPool() {
+        if (loaderPool_ == nullptr) {
+            auto threadCount = std::clamp(std::thread::hardware_concurrency(), 1u, kMaxLoaderThreads);
+            // Instances may be instantiated on loader threads, which need their own runtime state
+            loaderPool_ = std::make_unique<ThreadPool>(threadCount, []() { wasm_rt_init_thread(); }, []() { wasm_rt_free_thread(); });
+        }
+        return *loaderPool_;
+    }
+
     void ReactNativePolygen::unloadModule(jsi::Runtime &rt, jsi::Object module) {
         module.setNativeState(rt, nullptr);
     }
 
     jsi::Object ReactNativePolygen::getModuleMetadata(jsi::Runtime &rt, jsi::Object moduleHolder) {
         auto mod = NativeStateHelper::tryGet<Module>(rt, moduleHolder);
-        return buildModuleMetadata(rt, mod);
+        return getCachedModuleMetadata(rt, mod, jsInvoker_);
     }
 
     void ReactNativePolygen::createModuleInstance(jsi::Runtime &rt, jsi::Object instanceHolder,
                                                   jsi::Object moduleHolder, jsi::Object importObject) {
+        auto inst = linkModuleInstance(rt, moduleHolder, std::move(importObject));
+        inst->instantiate();
+        inst->attach(rt, instanceHolder);
+    }
+
+    void ReactNativePolygen::createLazyModuleInstance(jsi::Runtime &rt, jsi::Object instanceHolder,
+                                                      jsi::Object moduleHolder, jsi::Object importObject) {
+        // Instantiated by the exports object, on first access
+        auto inst = linkModuleInstance(rt, moduleHolder, std::move(importObject));
+        inst->attach(rt, instanceHolder);
+    }
+
+    jsi::Value ReactNativePolygen::createModuleInstanceAsync(jsi::Runtime &rt, jsi::Object instanceHolder,
+                                                             jsi::Object moduleHolder, jsi::Object importObject) {
+        // Imports are linked before leaving the JS thread, as linking reads the import object
+        auto inst = linkModuleInstance(rt, moduleHolder, std::move(importObject));
+        auto creation = std::make_shared<ModuleInstanceCreation>(std::move(inst), std::move(instanceHolder));
+        // Tasks may outlive this module, so they only capture shared state
+        auto &pool = getLoaderPool();
+        auto jsInvoker = jsInvoker_;
+        auto shutdownSignal = shutdownSignal_;
+        return createPromiseAsJSIValue(rt, [&pool, jsInvoker, shutdownSignal, creation](jsi::Runtime &rt, std::shared_ptr<Promise> promise) {
+            creation->promise = std::move(promise);
+
+            pool.submit([jsInvoker, shutdownSignal, creation]() {
+                auto dispatcher = makeJSThreadImportDispatcher(jsInvoker, shutdownSignal);
+                try {
+                    ImportDispatchScope scope { dispatcher };
+                    creation->instance->instantiate();
+                } catch (...) {
+                    creation->error = std::current_exception();
+                }
+
+                jsInvoker->invokeAsync([creation](jsi::Runtime &rt) {
+                    auto inst = std::move(creation->instance);
+                    auto holder = std::move(*creation->holder);
+                    auto promise = std::move(creation->promise);
+                    auto error = std::exchange(creation->error, nullptr);
+                    creation->holder.reset();
+
+                    if (!error) {
+                        try {
+                            inst->attach(rt, holder);
+                        } catch (...) {
+                            error = std::current_exception();
+                        }
+                    }
+
+                    if (error) {
+                        rejectWithException(rt, *promise, std::move(error));
+                    } else {
+                        promise->resolve(jsi::Value::undefined());
+                    }
+                });
+            });
+        });
+    }
+
+    std::shared_ptr<ModuleContext> ReactNativePolygen::linkModuleInstance(jsi::Runtime &rt, jsi::Object &moduleHolder,
+                                                                          jsi::Object &&importObject) {
         auto mod = NativeStateHelper::tryGet<Module>(rt, moduleHolder);
-        mod->createInstance(rt, instanceHolder, std::move(importObject));
+        try {
+            return mod->createInstance(rt, std::move(importObject), getModuleRuntimeCache(rt, *mod));
+        } catch (const LinkError &linkError) {
+            throw makeLinkError(rt, linkError);
+        }
     }
 
     void ReactNativePolygen::destroyModuleInstance(jsi::Runtime &rt, jsi::Object instance) {
         instance.setNativeState(rt, nullptr);
     }
 
+    void ReactNativePolygen::resetModuleInstance(jsi::Runtime &rt, jsi::Object instance) {
+        auto inst = NativeStateHelper::tryGet<ModuleContext>(rt, instance);
+
+        // Lazy instances not used yet are still in the initial state
+        if (inst->isInstantiated()) {
+            inst->reset();
+        }
+    }
+
+    void ReactNativePolygen::rebindModuleInstanceImports(jsi::Runtime &rt, jsi::Object instance,
+                                                         jsi::Object importObject) {
+        auto inst = NativeStateHelper::tryGet<ModuleContext>(rt, instance);
+        const auto &mod = inst->getModule();
+        try {
+            inst->rebindImports(mod.link(rt, importObject, getModuleRuntimeCache(rt, mod)));
+        } catch (const LinkError &linkError) {
+            throw makeLinkError(rt, linkError);
+        }
+    }
+
+    void ReactNativePolygen::snapshotModuleInstance(jsi::Runtime &rt, jsi::Object instance, jsi::String path) {
+        auto inst = NativeStateHelper::tryGet<ModuleContext>(rt, instance);
+        inst->ensureInstantiated();
+        try {
+            inst->snapshot(path.utf8(rt));
+        } catch (const SnapshotError &snapshotError) {
+            throw jsi::JSError(rt, snapshotError.what());
+        }
+    }
+
+    void ReactNativePolygen::restoreModuleInstance(jsi::Runtime &rt, jsi::Object instance, jsi::String path) {
+        auto inst = NativeStateHelper::tryGet<ModuleContext>(rt, instance);
+        inst->ensureInstantiated();
+        try {
+            inst->restore(path.utf8(rt));
+        } catch (const SnapshotError &snapshotError) {
+            throw jsi::JSError(rt, snapshotError.what());
+        }
+    }
+
+    void ReactNativePolygen::callExportBatch(jsi::Runtime &rt, jsi::Object instance, jsi::String name,
+                                             jsi::Object args, jsi::Object results, double count) {
+        auto inst = NativeStateHelper::tryGet<ModuleContext>(rt, instance);
+        auto exportName = name.utf8(rt);
+        auto exportIndex = inst->getModule().findExport(exportName);
+        if (!exportIndex.has_value()) {
+            throw jsi::JSError(rt, "Module has no export named '" + exportName + "'");
+        }
+
+        inst->ensureInstantiated();
+        try {
+            auto called = inst->callBatch(*exportIndex, getFloat64ArrayView(rt, args, "Arguments"),
+                                          getFloat64ArrayView(rt, results, "Results"), getBatchCallCount(count));
+            if (!called) {
+                throw jsi::JSError(rt, "Export '" + exportName + "' cannot be called in batch");
+            }
+        } catch (const BatchCallError &batchError) {
+            throw jsi::JSError(rt, batchError.what());
+        }
+    }
+
 
     // Memories
     void ReactNativePolygen::createMemory(jsi::Runtime &rt, jsi::Object holder, double initial,
@@ -91,23 +591,22 @@ namespace facebook::react {
 
     // Globals
     void ReactNativePolygen::createGlobal(jsi::Runtime &rt, jsi::Object holder, jsi::Object globalDescriptor,
-                                          double initialValue) {
+                                          jsi::Value initialValue) {
         auto descriptor = Bridging<NativeGlobalDescriptor>::fromJs(rt, globalDescriptor, jsInvoker_);
         auto waType = static_cast<Global::Type>(descriptor.type);
-        jsi::Value initial{initialValue};
 
-        auto globalVar = std::make_shared<Global>(waType, std::move(initial), descriptor.isMutable);
+        auto globalVar = std::make_shared<Global>(waType, rt, initialValue, descriptor.isMutable);
         NativeStateHelper::attach(rt, holder, globalVar);
     }
 
-    double ReactNativePolygen::getGlobalValue(jsi::Runtime &rt, jsi::Object instance) {
+    jsi::Value ReactNativePolygen::getGlobalValue(jsi::Runtime &rt, jsi::Object instance) {
         auto globalVar = NativeStateHelper::tryGet<Global>(rt, instance);
-        return globalVar->getValue().asNumber();
+        return globalVar->getValue(rt);
     }
 
-    void ReactNativePolygen::setGlobalValue(jsi::Runtime &rt, jsi::Object instance, double newValue) {
+    void ReactNativePolygen::setGlobalValue(jsi::Runtime &rt, jsi::Object instance, jsi::Value newValue) {
         auto globalVar = NativeStateHelper::tryGet<Global>(rt, instance);
-        globalVar->setValue(rt, {newValue});
+        globalVar->setValue(rt, newValue);
     }
 
 
@@ -156,26 +655,4 @@ namespace facebook::react {
         auto table = NativeStateHelper::tryGet<Table>(rt, instance);
         return table->getSize();
     }
-
-    jsi::Object ReactNativePolygen::buildModuleMetadata(jsi::Runtime &rt, const std::shared_ptr<Module> &mod) {
-        auto imports = mod->getImports();
-        auto exports = mod->getExports();
-
-        std::vector<NativeImportDescriptor> importsMapped;
-        std::vector<NativeExportDescriptor> exportsMapped;
-
-        importsMapped.reserve(imports.size());
-        exportsMapped.reserve(exports.size());
-
-        for (auto &import_: imports) {
-            importsMapped.push_back({import_.module, import_.name, static_cast<NativeSymbolKind>(import_.kind)});
-        }
-
-        for (auto &export_: exports) {
-            exportsMapped.push_back({export_.name, static_cast<NativeSymbolKind>(export_.kind)});
-        }
-
-        NativeModuleMetadata result{importsMapped, exportsMapped};
-        return bridging::toJs(rt, result, this->jsInvoker_);
-    }
 }
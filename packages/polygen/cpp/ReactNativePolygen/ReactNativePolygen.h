@@ -6,10 +6,13 @@
  */
 #pragma once
 
+#include <optional>
+#include <string>
 #include <ReactCommon/TurboModule.h>
 #include <RNPolygenSpecJSI.h>
 #include <ReactNativePolygen/WebAssembly.h>
 #include <ReactNativePolygen/Loader.h>
+#include <ReactNativePolygen/utils/ThreadPool.h>
 
 namespace facebook::react {
 
@@ -48,22 +51,54 @@ struct Bridging<NativeExportDescriptor> : public NativePolygenModuleExportDescri
 template <>
 struct Bridging<NativeModuleMetadata> : public NativePolygenInternalModuleMetadataBridging<NativeModuleMetadata> {};
 
+/**
+ * Location of the persistent verification cache, provided by the platform.
+ */
+struct VerificationCacheOptions {
+  /**
+   * Path to the cache file, in the application cache directory.
+   */
+  std::string path;
+
+  /**
+   * Version of the application, invalidating the cache when changed.
+   */
+  std::string appVersion;
+};
+
+/**
+ * Signals loader threads waiting for the JS thread that the module is being destroyed.
+ */
+struct LoaderShutdownSignal;
+
 class ReactNativePolygen : public NativePolygenCxxSpecJSI {
 public:
   constexpr static auto kModuleName = "Polygen";
 
-  explicit ReactNativePolygen(std::shared_ptr<CallInvoker> jsInvoker);
+  explicit ReactNativePolygen(
+    std::shared_ptr<CallInvoker> jsInvoker,
+    std::optional<VerificationCacheOptions> verificationCacheOptions = std::nullopt
+  );
   virtual ~ReactNativePolygen();
 
   bool copyNativeHandle(jsi::Runtime &rt, jsi::Object holder, jsi::Object source) override;
 
   // Modules
   jsi::Object loadModule(jsi::Runtime &rt, jsi::Object holder, jsi::Object moduleData) override;
+  jsi::Object loadModuleFromFile(jsi::Runtime &rt, jsi::Object holder, jsi::String path) override;
+  jsi::Value loadModules(jsi::Runtime &rt, jsi::Array holders, jsi::Array sources) override;
   void unloadModule(jsi::Runtime &rt, jsi::Object moduleHolder) override;
   jsi::Object getModuleMetadata(jsi::Runtime &rt, jsi::Object moduleHolder) override;
 
   void createModuleInstance(jsi::Runtime &rt, jsi::Object instanceHolder, jsi::Object moduleHolder, jsi::Object importObject) override;
+  jsi::Value createModuleInstanceAsync(jsi::Runtime &rt, jsi::Object instanceHolder, jsi::Object moduleHolder, jsi::Object importObject) override;
+  void createLazyModuleInstance(jsi::Runtime &rt, jsi::Object instanceHolder, jsi::Object moduleHolder, jsi::Object importObject) override;
   void destroyModuleInstance(jsi::Runtime &rt, jsi::Object instance) override;
+  void resetModuleInstance(jsi::Runtime &rt, jsi::Object instance) override;
+  void rebindModuleInstanceImports(jsi::Runtime &rt, jsi::Object instance, jsi::Object importObject) override;
+  void snapshotModuleInstance(jsi::Runtime &rt, jsi::Object instance, jsi::String path) override;
+  void restoreModuleInstance(jsi::Runtime &rt, jsi::Object instance, jsi::String path) override;
+  void callExportBatch(jsi::Runtime &rt, jsi::Object instance, jsi::String name, jsi::Object args, jsi::Object results, double count) override;
 
   // Memories
   void createMemory(jsi::Runtime &rt, jsi::Object holder, double initial, std::optional<double> maximum) override;
@@ -71,9 +106,9 @@ public:
   void growMemory(jsi::Runtime &rt, jsi::Object instance, double delta) override;
 
   // Globals
-  void createGlobal(jsi::Runtime &rt, jsi::Object holder, jsi::Object globalDescriptor, double initialValue) override;
-  double getGlobalValue(jsi::Runtime &rt, jsi::Object instance) override;
-  void setGlobalValue(jsi::Runtime &rt, jsi::Object instance, double newValue) override;
+  void createGlobal(jsi::Runtime &rt, jsi::Object holder, jsi::Object globalDescriptor, jsi::Value initialValue) override;
+  jsi::Value getGlobalValue(jsi::Runtime &rt, jsi::Object instance) override;
+  void setGlobalValue(jsi::Runtime &rt, jsi::Object instance, jsi::Value newValue) override;
 
   // Tables
   void createTable(jsi::Runtime &rt, jsi::Object holder, jsi::Object tableDescriptor, std::optional<jsi::Object> initial) override;
@@ -84,9 +119,17 @@ public:
 
 private:
   // Utility
-  jsi::Object buildModuleMetadata(jsi::Runtime &rt, const std::shared_ptr<callstack::polygen::Module>& mod);
+  callstack::polygen::ThreadPool& getLoaderPool();
+  std::shared_ptr<callstack::polygen::ModuleContext> linkModuleInstance(jsi::Runtime &rt, jsi::Object &moduleHolder, jsi::Object &&importObject);
+
+  // Shared with loader threads, which may outlive the module
+  std::shared_ptr<LoaderShutdownSignal> shutdownSignal_;
+
   const callstack::polygen::ModuleBag& moduleRegistry_;
   callstack::polygen::Loader moduleLoader_;
+
+  // Destroyed first, so that pending tasks can still use the loader
+  std::unique_ptr<callstack::polygen::ThreadPool> loaderPool_;
 };
 
 }
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <array>
+#include <jsi/jsi.h>
+
+namespace callstack::polygen {
+
+/**
+ * Buffer of a module instance that exported functions write multiple returned values to.
+ *
+ * The buffer is held by the instance context and exposed to JavaScript as an `ArrayBuffer`
+ * keeping the context alive, so returning multiple values does not allocate an array on every call.
+ */
+template <size_t Capacity>
+class ResultBuffer: public facebook::jsi::MutableBuffer {
+public:
+  size_t size() const override {
+    return Capacity * sizeof(double);
+  }
+
+  uint8_t* data() override {
+    return reinterpret_cast<uint8_t*>(values_.data());
+  }
+
+  double* values() {
+    return values_.data();
+  }
+
+private:
+  std::array<double, Capacity> values_ {};
+};
+
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <jsi/jsi.h>
+
+namespace callstack::polygen {
+
+/**
+ * Exported functions of a module, shared by all instances of that module within a runtime.
+ *
+ * Shared functions do not capture the module instance. Instead, they resolve it from the
+ * native state of `this` value when called, so creating an instance does not create any
+ * per-export closures.
+ */
+class SharedExportFunctions {
+public:
+  /**
+   * Creates shared function of export at specified position in `Module::getExports()`.
+   *
+   * Returns `undefined` for exports that are not functions.
+   */
+  using ExportFactory = facebook::jsi::Value (*)(facebook::jsi::Runtime& rt, size_t exportIndex);
+
+  SharedExportFunctions(size_t exportCount, ExportFactory factory): factory_(factory) {
+    functions_.resize(exportCount);
+  }
+
+  /**
+   * Returns shared function for specified export, creating it on first use.
+   */
+  const facebook::jsi::Value& get(facebook::jsi::Runtime& rt, size_t exportIndex) {
+    auto& function = functions_[exportIndex];
+    if (function.isUndefined()) {
+      function = factory_(rt, exportIndex);
+    }
+
+    return function;
+  }
+
+  /**
+   * Returns functions shared by module instances created using specified factory in the runtime.
+   *
+   * Functions are owned by live instances, and are released together with the last one.
+   */
+  static std::shared_ptr<SharedExportFunctions> forModule(facebook::jsi::Runtime& rt, size_t exportCount, ExportFactory factory) {
+    static std::mutex registryMutex;
+    static std::map<std::pair<facebook::jsi::Runtime*, ExportFactory>, std::weak_ptr<SharedExportFunctions>> registry;
+
+    std::lock_guard lock { registryMutex };
+    auto key = std::make_pair(&rt, factory);
+    if (auto found = registry.find(key); found != registry.end()) {
+      if (auto existing = found->second.lock()) {
+        return existing;
+      }
+    }
+
+    // Drop entries of released modules, including ones of destroyed runtimes
+    std::erase_if(registry, [](const auto& entry) { return entry.second.expired(); });
+
+    auto created = std::make_shared<SharedExportFunctions>(exportCount, factory);
+    registry.emplace(key, created);
+    return created;
+  }
+
+private:
+  ExportFactory factory_;
+  std::vector<facebook::jsi::Value> functions_;
+};
+
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#include "Snapshot.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <map>
+#include <utility>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace callstack::polygen {
+
+namespace {
+
+constexpr uint64_t kSnapshotMagic = 0x314e534e47594c50ull; // "PLYGNSN1"
+constexpr uint64_t kWasmPageSize = 65536;
+
+struct SnapshotHeader {
+  uint64_t magic;
+  ModuleChecksum checksum;
+  uint64_t stateSize;
+};
+
+struct MemoryDescriptor {
+  uint64_t pages;
+  uint64_t offset;
+};
+
+constexpr int32_t kNullElement = -1;
+constexpr wasm_rt_funcref_t kNullFuncRef { nullptr, nullptr, { nullptr }, nullptr };
+
+uint64_t alignToWasmPage(uint64_t size) {
+  return (size + kWasmPageSize - 1) / kWasmPageSize * kWasmPageSize;
+}
+
+[[noreturn]] void throwSystemError(const std::string& what) {
+  throw SnapshotError(what + ": " + std::strerror(errno));
+}
+
+void writeFully(int fd, const uint8_t* data, size_t size, uint64_t offset) {
+  while (size > 0) {
+    auto written = pwrite(fd, data, size, (off_t)offset);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throwSystemError("Could not write snapshot");
+    }
+
+    data += written;
+    size -= (size_t)written;
+    offset += (uint64_t)written;
+  }
+}
+
+void readFully(int fd, uint8_t* data, size_t size, uint64_t offset) {
+  while (size > 0) {
+    auto read = pread(fd, data, size, (off_t)offset);
+    if (read < 0 && errno == EINTR) {
+      continue;
+    }
+    if (read <= 0) {
+      throw SnapshotError("Snapshot is truncated");
+    }
+
+    data += read;
+    size -= (size_t)read;
+    offset += (uint64_t)read;
+  }
+}
+
+bool isZeroPage(const uint8_t* page) {
+  return page[0] == 0 && std::memcmp(page, page + 1, kWasmPageSize - 1) == 0;
+}
+
+std::pair<uintptr_t, uintptr_t> getFuncRefKey(const wasm_rt_funcref_t& ref) {
+  return { reinterpret_cast<uintptr_t>(ref.func), reinterpret_cast<uintptr_t>(ref.module_instance) };
+}
+
+}
+
+void SnapshotWriter::writeMemory(const wasm_rt_memory_t& memory) {
+  memories_.push_back({ &memory, state_.size() });
+  writeValue(MemoryDescriptor { .pages = memory.pages, .offset = 0 });
+}
+
+void SnapshotWriter::writeFuncRefTable(const wasm_rt_funcref_table_t& table, const InitialFuncRefTable& initial) {
+  std::map<std::pair<uintptr_t, uintptr_t>, int32_t> initialIndices;
+  for (size_t i = initial.size(); i-- > 0;) {
+    initialIndices.insert_or_assign(getFuncRefKey(initial[i]), (int32_t)i);
+  }
+
+  writeValue(table.size);
+  for (uint32_t i = 0; i < table.size; i++) {
+    const auto& element = table.data[i];
+    if (element.func == nullptr) {
+      writeValue(kNullElement);
+      continue;
+    }
+
+    auto found = initialIndices.find(getFuncRefKey(element));
+    if (found == initialIndices.end()) {
+      throw SnapshotError("Table element " + std::to_string(i) + " was not in the table when the instance was created");
+    }
+    writeValue(found->second);
+  }
+}
+
+void SnapshotWriter::writeExternRefTable(const wasm_rt_externref_table_t& table) {
+  writeValue(table.size);
+  for (uint32_t i = 0; i < table.size; i++) {
+    if (table.data[i] != nullptr) {
+      throw SnapshotError("Tables holding external references cannot be saved");
+    }
+  }
+}
+
+void SnapshotWriter::save(const std::string& path) {
+  auto offset = alignToWasmPage(sizeof(SnapshotHeader) + state_.size());
+  for (const auto& pending : memories_) {
+    auto* descriptor = state_.data() + pending.descriptorOffset + offsetof(MemoryDescriptor, offset);
+    std::memcpy(descriptor, &offset, sizeof(offset));
+    offset += alignToWasmPage(pending.memory->size);
+  }
+
+  auto temporaryPath = path + ".tmp";
+  int fd = ::open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    throwSystemError("Could not create snapshot");
+  }
+
+  try {
+    SnapshotHeader header { .magic = kSnapshotMagic, .checksum = checksum_, .stateSize = state_.size() };
+    writeFully(fd, (const uint8_t*)&header, sizeof(header), 0);
+    writeFully(fd, state_.data(), state_.size(), sizeof(header));
+
+    for (const auto& pending : memories_) {
+      MemoryDescriptor descriptor;
+      std::memcpy(&descriptor, state_.data() + pending.descriptorOffset, sizeof(descriptor));
+      for (uint64_t page = 0; page < pending.memory->size; page += kWasmPageSize) {
+        const auto* data = pending.memory->data + page;
+        if (!isZeroPage(data)) {
+          writeFully(fd, data, kWasmPageSize, descriptor.offset + page);
+        }
+      }
+    }
+
+    // Pages left as holes read as zeroes
+    if (ftruncate(fd, (off_t)offset) != 0) {
+      throwSystemError("Could not write snapshot");
+    }
+  } catch (...) {
+    ::close(fd);
+    ::unlink(temporaryPath.c_str());
+    throw;
+  }
+
+  ::close(fd);
+  if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+    ::unlink(temporaryPath.c_str());
+    throwSystemError("Could not save snapshot");
+  }
+}
+
+SnapshotReader::SnapshotReader(const std::string& path, const ModuleChecksum& checksum) {
+  fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd_ < 0) {
+    throwSystemError("Could not open snapshot");
+  }
+
+  try {
+    struct stat fileStat;
+    if (fstat(fd_, &fileStat) != 0) {
+      throwSystemError("Could not open snapshot");
+    }
+    fileSize_ = (uint64_t)fileStat.st_size;
+
+    SnapshotHeader header;
+    if (fileSize_ < sizeof(header)) {
+      throw SnapshotError("Snapshot is truncated");
+    }
+    readFully(fd_, (uint8_t*)&header, sizeof(header), 0);
+    if (header.magic != kSnapshotMagic) {
+      throw SnapshotError("File is not a module instance snapshot");
+    }
+    if (header.checksum != checksum) {
+      throw SnapshotError("Snapshot was created for a different module");
+    }
+    if (header.stateSize > fileSize_ - sizeof(header)) {
+      throw SnapshotError("Snapshot is truncated");
+    }
+
+    state_.resize(header.stateSize);
+    readFully(fd_, state_.data(), state_.size(), sizeof(header));
+  } catch (...) {
+    ::close(fd_);
+    throw;
+  }
+}
+
+SnapshotReader::~SnapshotReader() {
+  // Mapped memories keep their own reference to the file
+  ::close(fd_);
+}
+
+const uint8_t* SnapshotReader::consume(size_t size) {
+  if (size > state_.size() - position_) {
+    throw SnapshotError("Snapshot does not match layout of the module instance");
+  }
+
+  auto* data = state_.data() + position_;
+  position_ += size;
+  return data;
+}
+
+void SnapshotReader::readMemory(wasm_rt_memory_t& memory) {
+  auto descriptor = readValue<MemoryDescriptor>();
+  auto size = descriptor.pages * kWasmPageSize;
+  if (descriptor.offset % kWasmPageSize != 0 || descriptor.offset > fileSize_ || size > fileSize_ - descriptor.offset) {
+    throw SnapshotError("Snapshot is truncated");
+  }
+
+  // Memories never shrink, so the new instance cannot have more pages than the saved one
+  if (descriptor.pages < memory.pages) {
+    throw SnapshotError("Snapshot does not match layout of the module instance");
+  }
+  if (descriptor.pages > memory.pages && wasm_rt_grow_memory(&memory, descriptor.pages - memory.pages) == (uint64_t)-1) {
+    throw SnapshotError("Could not grow memory to the size saved in snapshot");
+  }
+
+  if (!polygen_map_memory_from_file(&memory, fd_, descriptor.offset, size)) {
+    throwSystemError("Could not map memory from snapshot");
+  }
+}
+
+void SnapshotReader::readFuncRefTable(wasm_rt_funcref_table_t& table, const InitialFuncRefTable& initial) {
+  auto size = readValue<uint32_t>();
+  if (size < table.size) {
+    throw SnapshotError("Snapshot does not match layout of the module instance");
+  }
+  if (size > table.size && wasm_rt_grow_funcref_table(&table, size - table.size, kNullFuncRef) == (uint32_t)-1) {
+    throw SnapshotError("Could not grow table to the size saved in snapshot");
+  }
+
+  for (uint32_t i = 0; i < size; i++) {
+    auto index = readValue<int32_t>();
+    if (index == kNullElement) {
+      table.data[i] = kNullFuncRef;
+    } else if (index >= 0 && (size_t)index < initial.size()) {
+      table.data[i] = initial[index];
+    } else {
+      throw SnapshotError("Snapshot does not match layout of the module instance");
+    }
+  }
+}
+
+void SnapshotReader::readExternRefTable(wasm_rt_externref_table_t& table) {
+  auto size = readValue<uint32_t>();
+  if (size < table.size) {
+    throw SnapshotError("Snapshot does not match layout of the module instance");
+  }
+  if (size > table.size && wasm_rt_grow_externref_table(&table, size - table.size, nullptr) == (uint32_t)-1) {
+    throw SnapshotError("Could not grow table to the size saved in snapshot");
+  }
+
+  std::fill(table.data, table.data + size, nullptr);
+}
+
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <wasm-rt.h>
+#include <ReactNativePolygen/utils/checksum.h>
+
+extern "C" {
+
+bool polygen_map_memory_from_file(wasm_rt_memory_t* memory, int fd, uint64_t offset, uint64_t size);
+
+}
+
+namespace callstack::polygen {
+
+/**
+ * Thrown when an instance cannot be saved to, or restored from a snapshot.
+ */
+class SnapshotError: public std::runtime_error {
+public:
+  explicit SnapshotError(const std::string& what): std::runtime_error(what) {}
+};
+
+/**
+ * Elements of a funcref table, as initialized when the instance was created.
+ *
+ * Table elements are saved as positions of the same elements in the initial table,
+ * as function addresses change between launches.
+ */
+using InitialFuncRefTable = std::vector<wasm_rt_funcref_t>;
+
+inline InitialFuncRefTable copyFuncRefTable(const wasm_rt_funcref_table_t& table) {
+  return { table.data, table.data + table.size };
+}
+
+/**
+ * Collects state of a module instance and saves it to a snapshot file.
+ *
+ * Memories are written after all other state, each aligned to a WebAssembly page,
+ * so that they can be mapped from the file when restoring. Pages that are all zeroes
+ * are left as holes in the file.
+ */
+class SnapshotWriter {
+public:
+  explicit SnapshotWriter(const ModuleChecksum& checksum): checksum_(checksum) {}
+
+  template <typename T>
+  void writeValue(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto offset = state_.size();
+    state_.resize(offset + sizeof(T));
+    std::memcpy(state_.data() + offset, &value, sizeof(T));
+  }
+
+  void writeMemory(const wasm_rt_memory_t& memory);
+  void writeFuncRefTable(const wasm_rt_funcref_table_t& table, const InitialFuncRefTable& initial);
+  void writeExternRefTable(const wasm_rt_externref_table_t& table);
+
+  /**
+   * Writes the snapshot to specified path, replacing existing file only once it is complete.
+   */
+  void save(const std::string& path);
+
+private:
+  struct PendingMemory {
+    const wasm_rt_memory_t* memory;
+    size_t descriptorOffset;
+  };
+
+  ModuleChecksum checksum_;
+  std::vector<uint8_t> state_;
+  std::vector<PendingMemory> memories_;
+};
+
+/**
+ * Reads state of a module instance from a snapshot file.
+ *
+ * State must be read in the order it was written in. Memories are mapped from the
+ * file as private copy-on-write pages, so restoring does not read them upfront.
+ */
+class SnapshotReader {
+public:
+  /**
+   * Opens snapshot at specified path, verifying it was created for the module.
+   */
+  SnapshotReader(const std::string& path, const ModuleChecksum& checksum);
+  ~SnapshotReader();
+
+  SnapshotReader(const SnapshotReader&) = delete;
+  SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+  template <typename T>
+  T readValue() {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    std::memcpy(&value, consume(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  void readMemory(wasm_rt_memory_t& memory);
+  void readFuncRefTable(wasm_rt_funcref_table_t& table, const InitialFuncRefTable& initial);
+  void readExternRefTable(wasm_rt_externref_table_t& table);
+
+private:
+  const uint8_t* consume(size_t size);
+
+  int fd_;
+  uint64_t fileSize_;
+  std::vector<uint8_t> state_;
+  size_t position_ = 0;
+};
+
+}
@@ -6,31 +6,25 @@
  */
 #pragma once
 
+#include <array>
 #include "Module.h"
 
 namespace callstack::polygen {
 
+/**
+ * Module compiled into the application, described by constant data emitted by codegen.
+ */
 class StaticLibraryModule : public Module {
 public:
   StaticLibraryModule(
-    const std::string& name,
-    std::vector<Import>&& imports,
-    std::vector<Export>&& exports,
-    Factory&& factory
-  ) : Module(name, std::move(imports), std::move(exports), std::move(factory)) {}
-  StaticLibraryModule(
-    std::string&& name,
-    std::vector<Import>&& imports,
-    std::vector<Export>&& exports,
+    std::string_view name,
+    std::span<const Import> imports,
+    std::span<const Export> exports,
     Factory&& factory
-  ) : Module(std::move(name), std::move(imports), std::move(exports), std::move(factory)) {}
+  ) : Module(name, imports, exports, std::move(factory)) {}
   ~StaticLibraryModule() {}
 
-  StaticLibraryModule(StaticLibraryModule&& other) = default;
-  StaticLibraryModule& operator=(StaticLibraryModule&& other) = default;
-
   StaticLibraryModule(const StaticLibraryModule& other) = delete;
   StaticLibraryModule& operator=(const StaticLibraryModule& other) = delete;
 };
-
 }
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <wasm-rt.h>
+
+extern "C" {
+
+void polygen_set_table_arena(void* data, size_t size);
+
+}
+
+namespace callstack::polygen {
+
+/**
+ * Storage of tables with fixed size, held by the instance context.
+ *
+ * Context of a generated module reserves space for elements of tables whose minimum size is equal
+ * to their maximum size, so that instantiating the module does not allocate them separately.
+ * Tables which may grow are still allocated by the runtime, as growing them reallocates their elements.
+ */
+template <size_t Size>
+class TableArena {
+public:
+  /**
+   * Makes the runtime allocate tables with fixed size from the arena in order, and not free
+   * tables allocated from it, until destroyed.
+   *
+   * Tables are allocated before the start function is called, so a nested scope, e.g. when the
+   * start function instantiates another module, does not need to restore the outer one.
+   */
+  class Scope {
+  public:
+    explicit Scope(TableArena& arena) {
+      polygen_set_table_arena(arena.storage_, Size);
+    }
+
+    ~Scope() {
+      polygen_set_table_arena(nullptr, 0);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  };
+
+private:
+  alignas(wasm_rt_funcref_t) uint8_t storage_[Size];
+};
+
+}
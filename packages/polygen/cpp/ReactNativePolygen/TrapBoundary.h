@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <wasm-rt.h>
+#include <ReactNativePolygen/bridge.h>
+
+extern "C" {
+
+wasm_rt_jmp_buf* polygen_get_trap_jmp_buf(void);
+uint32_t polygen_save_call_stack_depth(void);
+void polygen_restore_saved_call_stack_depth(uint32_t depth);
+
+}
+
+/**
+ * Sets up trap boundary, same as `wasm_rt_try()`.
+ *
+ * Signal handlers installed by the runtime do not block the signal they handle,
+ * so the signal mask does not need to be saved, which would cost a system call per call.
+ */
+#ifndef _WIN32
+#define POLYGEN_TRAP_TRY(target) ((target).initialized = true, sigsetjmp((target).buffer, 0))
+#else
+#define POLYGEN_TRAP_TRY(target) wasm_rt_try(target)
+#endif
+
+namespace callstack::polygen {
+
+/**
+ * Exception thrown by an imported function, waiting to be rethrown by the trap boundary.
+ */
+inline std::exception_ptr& pendingImportException() {
+  static thread_local std::exception_ptr exception;
+  return exception;
+}
+
+/**
+ * Runs `call` on the JS thread and waits for it to complete, rethrowing its exception.
+ */
+using ImportDispatcher = std::function<void (const std::function<void ()>& call)>;
+
+inline ImportDispatcher*& currentImportDispatcher() {
+  static thread_local ImportDispatcher* dispatcher = nullptr;
+  return dispatcher;
+}
+
+/**
+ * Dispatches imports accessed by WebAssembly code running on the current thread to the JS thread.
+ *
+ * Imports hold JavaScript values, which may only be used on the JS thread. This lets instances
+ * be instantiated on other threads, as the start function and imported memories, tables and
+ * globals are accessed while instantiating.
+ */
+class ImportDispatchScope {
+public:
+  explicit ImportDispatchScope(ImportDispatcher& dispatcher)
+    : outerDispatcher_(std::exchange(currentImportDispatcher(), &dispatcher)) {}
+
+  ~ImportDispatchScope() {
+    currentImportDispatcher() = outerDispatcher_;
+  }
+
+  ImportDispatchScope(const ImportDispatchScope&) = delete;
+  ImportDispatchScope& operator=(const ImportDispatchScope&) = delete;
+
+private:
+  ImportDispatcher* outerDispatcher_;
+};
+
+/**
+ * Calls import implementation, on the JS thread if the current thread dispatches imports.
+ */
+template <typename TCall>
+inline auto invokeImport(TCall&& call) -> std::invoke_result_t<TCall&&> {
+  using TResult = std::invoke_result_t<TCall&&>;
+
+  auto* dispatcher = currentImportDispatcher();
+  if (dispatcher == nullptr) [[likely]] {
+    return std::forward<TCall>(call)();
+  }
+
+  if constexpr (std::is_void_v<TResult>) {
+    (*dispatcher)([&] { std::forward<TCall>(call)(); });
+  } else {
+    std::optional<TResult> result;
+    (*dispatcher)([&] { result.emplace(std::forward<TCall>(call)()); });
+    return std::move(*result);
+  }
+}
+
+/**
+ * Restores state of the enclosing trap boundary when leaving a nested one.
+ */
+class TrapBoundaryScope {
+public:
+  TrapBoundaryScope()
+    : jmpBuf_(polygen_get_trap_jmp_buf()), outerJmpBuf_(*jmpBuf_), outerCallStackDepth_(polygen_save_call_stack_depth()) {}
+
+  ~TrapBoundaryScope() {
+    *jmpBuf_ = outerJmpBuf_;
+    polygen_restore_saved_call_stack_depth(outerCallStackDepth_);
+  }
+
+  TrapBoundaryScope(const TrapBoundaryScope&) = delete;
+  TrapBoundaryScope& operator=(const TrapBoundaryScope&) = delete;
+
+  wasm_rt_jmp_buf& getJmpBuf() {
+    return *jmpBuf_;
+  }
+
+private:
+  wasm_rt_jmp_buf* jmpBuf_;
+  wasm_rt_jmp_buf outerJmpBuf_;
+  uint32_t outerCallStackDepth_;
+};
+
+/**
+ * Calls into WebAssembly code, converting traps into C++ exceptions once control is back in C++.
+ *
+ * Traps are raised by `wasm_rt_trap()`, which jumps back here using `longjmp`, so no C++
+ * exception is ever thrown through generated C code. `call` must not hold any objects
+ * with non-trivial destructors, as these would be skipped when a trap occurs.
+ *
+ * Boundaries can be nested, when WebAssembly code calls an imported function calling
+ * another export. Throws `TrapError` for traps, or rethrows exception of the imported
+ * function that interrupted the call.
+ */
+template <typename TCall>
+inline auto callWithTrapBoundary(TCall&& call) -> std::invoke_result_t<TCall&&> {
+  TrapBoundaryScope scope;
+
+  auto trap = (wasm_rt_trap_t)POLYGEN_TRAP_TRY(scope.getJmpBuf());
+  if (trap == WASM_RT_TRAP_NONE) [[likely]] {
+    return std::forward<TCall>(call)();
+  }
+
+  if (auto exception = std::exchange(pendingImportException(), nullptr)) {
+    std::rethrow_exception(exception);
+  }
+
+  throw TrapError(trap);
+}
+
+/**
+ * Calls imported function implementation from generated C code.
+ *
+ * Exceptions thrown by `call` are not propagated through generated code. Instead, they are
+ * stored and the call traps, so the exception is rethrown by the enclosing trap boundary.
+ */
+template <typename TCall>
+inline auto callImportFromWasm(TCall&& call) noexcept -> std::invoke_result_t<TCall&&> {
+  using TResult = std::invoke_result_t<TCall&&>;
+
+  if constexpr (std::is_void_v<TResult>) {
+    bool completed = false;
+    try {
+      invokeImport(std::forward<TCall>(call));
+      completed = true;
+    } catch (...) {
+      pendingImportException() = std::current_exception();
+    }
+
+    if (!completed) [[unlikely]] {
+      wasm_rt_trap(WASM_RT_TRAP_UNCAUGHT_EXCEPTION);
+    }
+  } else {
+    std::optional<TResult> result;
+    try {
+      result.emplace(invokeImport(std::forward<TCall>(call)));
+    } catch (...) {
+      pendingImportException() = std::current_exception();
+    }
+
+    if (!result.has_value()) [[unlikely]] {
+      wasm_rt_trap(WASM_RT_TRAP_UNCAUGHT_EXCEPTION);
+    }
+
+    return *result;
+  }
+}
+
+}
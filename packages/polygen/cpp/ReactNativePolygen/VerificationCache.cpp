@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#include "VerificationCache.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <ReactNativePolygen/utils/xxhash.h>
+
+namespace callstack::polygen {
+
+namespace {
+
+constexpr uint64_t kCacheMagic = 0x3243564e47594c50ull; // "PLYGNVC2"
+
+struct CacheHeader {
+  uint64_t magic;
+  uint64_t appVersionHash;
+  uint64_t entryCount;
+};
+
+}
+
+std::shared_ptr<VerificationCache> VerificationCache::open(const std::string& path, std::string_view appVersion, const ModuleBag& registry) {
+  auto entryCount = registry.getEntries().size();
+  auto size = sizeof(CacheHeader) + entryCount * sizeof(Slot);
+  auto appVersionHash = computeXXH3({(const uint8_t*)appVersion.data(), appVersion.size()});
+
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat fileStat;
+  bool hasExpectedSize = fstat(fd, &fileStat) == 0 && (size_t)fileStat.st_size == size;
+  if (!hasExpectedSize && ftruncate(fd, (off_t)size) != 0) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+
+  auto* header = (CacheHeader*)data;
+  if (!hasExpectedSize || header->magic != kCacheMagic || header->appVersionHash != appVersionHash
+      || header->entryCount != entryCount) {
+    std::memset(data, 0, size);
+    *header = { .magic = kCacheMagic, .appVersionHash = appVersionHash, .entryCount = entryCount };
+  }
+
+  return std::shared_ptr<VerificationCache>(new VerificationCache((uint8_t*)data, size, registry));
+}
+
+VerificationCache::~VerificationCache() {
+  munmap(data_, size_);
+}
+
+VerificationCache::Slot* VerificationCache::getSlot(const ModuleBagEntry& entry) const {
+  auto index = (size_t)(&entry - registry_.getEntries().data());
+  return (Slot*)(data_ + sizeof(CacheHeader)) + index;
+}
+
+bool VerificationCache::isVerified(const ModuleBagEntry& entry, const FileIdentity& file) const {
+  // Slot holds the checksum the module was verified against, so an entry whose module changed
+  // without the application version changing (e.g. during development) is verified again
+  std::lock_guard lock(mutex_);
+  auto* slot = getSlot(entry);
+  return slot->checksum == entry.checksum && slot->file == file;
+}
+
+void VerificationCache::markVerified(const ModuleBagEntry& entry, const FileIdentity& file) {
+  std::lock_guard lock(mutex_);
+  *getSlot(entry) = { .checksum = entry.checksum, .file = file };
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <ReactNativePolygen/ModuleBag.h>
+#include <ReactNativePolygen/utils/MappedFile.h>
+
+namespace callstack::polygen {
+
+/**
+ * Persistent record of modules whose checksums were verified, used by
+ * `ModuleVerification::Cached`.
+ *
+ * The cache is a small file memory-mapped from the application cache directory,
+ * holding a slot for every module bag entry. A slot stores the checksum the module
+ * matched when it was verified, along with identity of the file it was loaded from,
+ * so the same unchanged file is not hashed again on later launches. Any other file,
+ * even one with the same fingerprint, is hashed in full. The whole cache is discarded
+ * when the application version or the number of modules changes.
+ */
+class VerificationCache final {
+public:
+  /**
+   * Opens or creates cache file at specified path.
+   *
+   * Returns null if the file cannot be opened or mapped, in which case modules
+   * are verified on every load.
+   */
+  static std::shared_ptr<VerificationCache> open(const std::string& path, std::string_view appVersion, const ModuleBag& registry);
+
+  ~VerificationCache();
+
+  VerificationCache(const VerificationCache&) = delete;
+  VerificationCache& operator=(const VerificationCache&) = delete;
+
+  /**
+   * Returns true if checksum of the entry was verified for the current application version,
+   * when loaded from the same unchanged file.
+   */
+  bool isVerified(const ModuleBagEntry& entry, const FileIdentity& file) const;
+
+  /**
+   * Records that checksum of the entry was verified when loaded from the file.
+   */
+  void markVerified(const ModuleBagEntry& entry, const FileIdentity& file);
+
+private:
+  VerificationCache(uint8_t* data, size_t size, const ModuleBag& registry)
+    : data_(data), size_(size), registry_(registry) {}
+
+  struct Slot {
+    ModuleChecksum checksum;
+    FileIdentity file;
+  };
+
+  Slot* getSlot(const ModuleBagEntry& entry) const;
+
+  uint8_t* data_;
+  size_t size_;
+  const ModuleBag& registry_;
+  mutable std::mutex mutex_;
+};
+
+}
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <memory>
 #include <jsi/jsi.h>
 #include <wasm-rt.h>
 #include "Table.h"
@@ -21,7 +22,11 @@ public:
     wasm_rt_externref_t externRef;
   };
   
-  explicit ExternRefTable(wasm_rt_externref_table_t* table): table_(table) {}
+  /**
+   * Wraps table of a module instance, keeping `owner` holding the table alive.
+   */
+  explicit ExternRefTable(wasm_rt_externref_table_t* table, std::shared_ptr<void> owner = nullptr)
+    : table_(table), owner_(std::move(owner)) {}
   explicit ExternRefTable(size_t initialSize, std::optional<size_t> maxSize = std::nullopt): maxSize_(maxSize) {
     this->table_ = &this->ownedTable_;
     wasm_rt_allocate_externref_table(this->table_, initialSize, maxSize.value_or(Table::DEFAULT_MAX_SIZE));
@@ -74,6 +79,7 @@ protected:
   std::optional<size_t> maxSize_;
   wasm_rt_externref_table_t ownedTable_;
   wasm_rt_externref_table_t* table_;
+  std::shared_ptr<void> owner_;
 };
 
 }
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <jsi/jsi.h>
 #include <wasm-rt.h>
@@ -22,7 +23,11 @@ public:
     wasm_rt_funcref_t funcRef;
   };
   
-  explicit FuncRefTable(wasm_rt_funcref_table_t* table): table_(table) {}
+  /**
+   * Wraps table of a module instance, keeping `owner` holding the table alive.
+   */
+  explicit FuncRefTable(wasm_rt_funcref_table_t* table, std::shared_ptr<void> owner = nullptr)
+    : table_(table), owner_(std::move(owner)) {}
   explicit FuncRefTable(size_t initialSize, std::optional<size_t> maxSize = std::nullopt): maxSize_(maxSize) {
     this->table_ = &this->ownedTable_;
     wasm_rt_allocate_funcref_table(this->table_, initialSize, maxSize.value_or(Table::DEFAULT_MAX_SIZE));
@@ -76,6 +81,7 @@ protected:
   std::optional<size_t> maxSize_;
   wasm_rt_funcref_table_t ownedTable_;
   wasm_rt_funcref_table_t* table_;
+  std::shared_ptr<void> owner_;
 };
 
 }
@@ -31,20 +31,23 @@ public:
   };
 
   explicit Global(Type type, void* data, bool isMutable = false): type_(type), data_((Payload*)data), isMutable_(isMutable) {}
-  explicit Global(Type type, facebook::jsi::Value value, bool isMutable = false): type_(type), isMutable_(isMutable), data_(&ownedData_) {
-    setValueUnsafe(std::move(value));
+  explicit Global(Type type, facebook::jsi::Runtime& rt, const facebook::jsi::Value& value, bool isMutable = false): type_(type), isMutable_(isMutable), data_(&ownedData_) {
+    setValueUnsafe(rt, value);
   }
 
-  facebook::jsi::Value getValue() {
+  /**
+   * Returns value of the global. 64-bit integers are returned as `BigInt`.
+   */
+  facebook::jsi::Value getValue(facebook::jsi::Runtime& rt) {
     switch (type_) {
       case Type::I32:
         return { (double)data_->i32 };
       case Type::U32:
         return { (double)data_->u32 };
       case Type::I64:
-        return { (double)data_->i64 };
+        return facebook::jsi::BigInt::fromInt64(rt, (int64_t)data_->i64);
       case Type::U64:
-        return { (double)data_->u64 };
+        return facebook::jsi::BigInt::fromUint64(rt, (uint64_t)data_->u64);
       case Type::F32:
         return { (double)data_->f32 };
       case Type::F64:
@@ -56,7 +59,7 @@ public:
     return this->data_;
   }
 
-  void setValueUnsafe(facebook::jsi::Value newValue) {
+  void setValueUnsafe(facebook::jsi::Runtime& rt, const facebook::jsi::Value& newValue) {
     switch (type_) {
       case Type::I32:
         data_->i32 = newValue.asNumber();
@@ -65,10 +68,10 @@ public:
         data_->u32 = newValue.asNumber();
         break;
       case Type::I64:
-        data_->i64 = newValue.asNumber();
+        data_->i64 = newValue.isBigInt() ? newValue.getBigInt(rt).getInt64(rt) : (int64_t)newValue.asNumber();
         break;
       case Type::U64:
-        data_->u64 = newValue.asNumber();
+        data_->u64 = newValue.isBigInt() ? newValue.getBigInt(rt).getUint64(rt) : (uint64_t)newValue.asNumber();
         break;
       case Type::F32:
         data_->f32 = newValue.asNumber();
@@ -79,12 +82,12 @@ public:
     }
   }
 
-  void setValue(facebook::jsi::Runtime& rt, facebook::jsi::Value newValue) {
+  void setValue(facebook::jsi::Runtime& rt, const facebook::jsi::Value& newValue) {
     if (!isMutable_) {
       throw facebook::jsi::JSError(rt, "Cannot change immutable WebAssembly.Global value");
     }
 
-    setValueUnsafe(std::move(newValue));
+    setValueUnsafe(rt, newValue);
   }
 
   bool isMutable() const {
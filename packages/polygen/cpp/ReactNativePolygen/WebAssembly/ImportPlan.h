@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <jsi/jsi.h>
+#include <ReactNativePolygen/WebAssembly/Global.h>
+#include <ReactNativePolygen/WebAssembly/Memory.h>
+
+namespace callstack::polygen {
+
+enum class SymbolKind {
+  Function, Table, Memory, Global
+};
+
+struct ImportDescriptor {
+  std::string_view module;
+  std::string_view name;
+  SymbolKind kind;
+};
+
+/**
+ * Thrown when an import object does not provide all imports of a module.
+ */
+class LinkError: public std::runtime_error {
+public:
+  explicit LinkError(const std::string& what): std::runtime_error(what) {}
+};
+
+/**
+ * Objects of imported modules, resolved from an import object for a single instance.
+ */
+class LinkedImports {
+public:
+  /**
+   * Takes object of the imported module with specified name.
+   *
+   * Each module is taken once, by the import context created for it. Throws `LinkError`
+   * if the module was not linked.
+   */
+  facebook::jsi::Object takeModule(std::string_view name) {
+    auto found = std::find_if(modules_.begin(), modules_.end(), [&](const auto& module) {
+      return module.first == name;
+    });
+    if (found == modules_.end()) [[unlikely]] {
+      throw LinkError("Imported module " + std::string(name) + " is not provided");
+    }
+    return std::move(found->second);
+  }
+
+private:
+  friend class ImportPlan;
+
+  std::vector<std::pair<std::string_view, facebook::jsi::Object>> modules_;
+};
+
+/**
+ * Imports of a module grouped by imported module, compiled once per module and runtime.
+ *
+ * Property names are created when the plan is compiled, so linking an instance does not
+ * convert any strings, and resolves every imported module only once.
+ */
+class ImportPlan {
+public:
+  ImportPlan(facebook::jsi::Runtime& rt, std::span<const ImportDescriptor> imports) {
+    for (const auto& import : imports) {
+      auto module = std::find_if(modules_.begin(), modules_.end(), [&](const auto& module) {
+        return module.name == import.module;
+      });
+      if (module == modules_.end()) {
+        modules_.push_back({ import.module, makePropName(rt, import.module), {} });
+        module = std::prev(modules_.end());
+      }
+
+      module->symbols.push_back({ import.name, makePropName(rt, import.name), import.kind });
+    }
+  }
+
+  /**
+   * Resolves all imports from the import object, verifying their kinds.
+   *
+   * Throws `LinkError` when any import is missing or has an invalid kind.
+   */
+  LinkedImports link(facebook::jsi::Runtime& rt, const facebook::jsi::Object& importObject) const {
+    LinkedImports linked;
+    linked.modules_.reserve(modules_.size());
+
+    for (const auto& module : modules_) {
+      auto moduleValue = importObject.getProperty(rt, module.propName);
+      if (!moduleValue.isObject()) {
+        throw LinkError("Imported module " + std::string(module.name) + " is not provided");
+      }
+
+      auto moduleObject = moduleValue.getObject(rt);
+      for (const auto& symbol : module.symbols) {
+        verifySymbol(rt, module, symbol, moduleObject.getProperty(rt, symbol.propName));
+      }
+
+      linked.modules_.emplace_back(module.name, std::move(moduleObject));
+    }
+
+    return linked;
+  }
+
+private:
+  struct PlannedSymbol {
+    std::string_view name;
+    facebook::jsi::PropNameID propName;
+    SymbolKind kind;
+  };
+
+  struct PlannedModule {
+    std::string_view name;
+    facebook::jsi::PropNameID propName;
+    std::vector<PlannedSymbol> symbols;
+  };
+
+  static facebook::jsi::PropNameID makePropName(facebook::jsi::Runtime& rt, std::string_view name) {
+    return facebook::jsi::PropNameID::forUtf8(rt, (const uint8_t*) name.data(), name.size());
+  }
+
+  static void verifySymbol(
+    facebook::jsi::Runtime& rt,
+    const PlannedModule& module,
+    const PlannedSymbol& symbol,
+    const facebook::jsi::Value& value
+  ) {
+    auto describe = [&](const char* problem) {
+      return "Imported symbol " + std::string(module.name) + "." + std::string(symbol.name) + " " + problem;
+    };
+
+    if (value.isUndefined() || value.isNull()) {
+      throw LinkError(describe("is not provided"));
+    }
+
+    switch (symbol.kind) {
+      case SymbolKind::Function:
+        if (!value.isObject() || !value.getObject(rt).isFunction(rt)) {
+          throw LinkError(describe("is not a function"));
+        }
+        break;
+      case SymbolKind::Global:
+        if (!value.isObject() || !value.getObject(rt).hasNativeState<Global>(rt)) {
+          throw LinkError(describe("is not a global"));
+        }
+        break;
+      case SymbolKind::Memory:
+        if (!value.isObject() || !value.getObject(rt).hasNativeState<Memory>(rt)) {
+          throw LinkError(describe("is not a memory"));
+        }
+        break;
+      case SymbolKind::Table:
+        throw LinkError("Importing tables is not yet supported");
+    }
+  }
+
+  std::vector<PlannedModule> modules_;
+};
+
+}
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <memory>
 #include <jsi/jsi.h>
 #include <wasm-rt.h>
 
@@ -13,7 +14,11 @@ namespace callstack::polygen {
 
 class Memory: public facebook::jsi::NativeState, public facebook::jsi::MutableBuffer {
 public:
-  explicit Memory(wasm_rt_memory_t* memory): memory_(memory) {}
+  /**
+   * Wraps memory of a module instance, keeping `owner` holding the memory alive.
+   */
+  explicit Memory(wasm_rt_memory_t* memory, std::shared_ptr<void> owner = nullptr)
+    : memory_(memory), owner_(std::move(owner)) {}
   
   Memory(uint64_t initial, uint64_t maximum, bool is64 = false) {
     this->memory_ = &this->ownedMemory_;
@@ -53,6 +58,7 @@ public:
 private:
   wasm_rt_memory_t* memory_;
   wasm_rt_memory_t ownedMemory_;
+  std::shared_ptr<void> owner_;
 };
 
 }
@@ -6,11 +6,35 @@
  */
 #pragma once
 
-#include <string>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
 #include <jsi/jsi.h>
+#include <ReactNativePolygen/WebAssembly/ImportPlan.h>
 
 namespace callstack::polygen {
 
+class ModuleContext;
+
+/**
+ * JSI values derived from a module, created once per runtime it is used in.
+ */
+struct ModuleRuntimeCache {
+  /**
+   * Metadata object returned to JavaScript.
+   */
+  std::optional<facebook::jsi::Object> metadata;
+
+  /**
+   * Plan used to link imports of new instances.
+   */
+  std::optional<ImportPlan> importPlan;
+};
+
 /**
  * Represents a WebAssembly Module.
  *
@@ -18,73 +42,138 @@ namespace callstack::polygen {
  */
 class Module: public facebook::jsi::NativeState {
 public:
-  enum class SymbolKind {
-    Function, Table, Memory, Global
-  };
-  
-  using Factory = std::function<void (facebook::jsi::Runtime& rt, facebook::jsi::Object& target, facebook::jsi::Object&& importObject)>;
+  using SymbolKind = callstack::polygen::SymbolKind;
+  using Import = ImportDescriptor;
+
+  /**
+   * Creates context of a new instance with linked imports, which is not instantiated yet.
+   */
+  using Factory = std::function<std::shared_ptr<ModuleContext> (facebook::jsi::Runtime& rt, facebook::jsi::Object&& importObject, LinkedImports&& imports)>;
   
   struct Export {
-    std::string name;
+    std::string_view name;
     SymbolKind kind;
-    
-    Export(const std::string& name, SymbolKind kind): name(name), kind(kind) {}
-    Export(std::string&& name, SymbolKind kind): name(std::move(name)), kind(kind) {}
-  };
-    
-  struct Import {
-    std::string module;
-    std::string name;
-    SymbolKind kind;
-    
-    Import(const std::string& module, const std::string& name, SymbolKind kind)
-    : module(module), name(name), kind(kind) {}
-    
-    Import(std::string&& module, std::string&& name, SymbolKind kind)
-    : module(std::move(module)), name(std::move(name)), kind(kind) {}
   };
   
-  Module(const std::string& name,
-         std::vector<Import>&& imports,
-         std::vector<Export>&& exports,
+  /**
+   * Creates a module described by specified imports and exports.
+   *
+   * Descriptors are not copied, so they must outlive the module. Generated modules
+   * keep them in constant arrays.
+   */
+  Module(std::string_view name,
+         std::span<const Import> imports,
+         std::span<const Export> exports,
          Factory&& factory
-  ) : name_(name), imports_(std::move(imports)), exports_(std::move(exports)), factory_(std::move(factory)) {}
-  Module(std::string&& name,
-         std::vector<Import>&& imports,
-         std::vector<Export>&& exports,
-         Factory&& factory
-  ) : name_(std::move(name)), imports_(std::move(imports)), exports_(std::move(exports)), factory_(std::move(factory)) {}
+  ) : name_(name), imports_(imports), exports_(exports), factory_(std::move(factory)) {
+    indexExports();
+  }
   virtual ~Module() {}
 
-  // Allow moving
-  Module(Module&& other) = default;
-  Module& operator=(Module&& other) = default;
-
-  // Disallow copying
+  // Disallow copying and moving, runtime caches refer to the module
   Module(const Module& other) = delete;
   Module& operator=(const Module& other) = delete;
   
-  const std::string& getName() const {
+  std::string_view getName() const {
     return name_;
   }
   
-  const std::vector<Import>& getImports() const {
+  std::span<const Import> getImports() const {
     return imports_;
   }
   
-  const std::vector<Export>& getExports() const {
+  std::span<const Export> getExports() const {
     return exports_;
   }
   
-  void createInstance(facebook::jsi::Runtime& rt, facebook::jsi::Object& target, facebook::jsi::Object&& importObject) const {
-    factory_(rt, target, std::move(importObject));
+  /**
+   * Returns position of export with specified name in `getExports()` list, if any.
+   */
+  std::optional<size_t> findExport(std::string_view name) const {
+    if (auto found = exportIndices_.find(name); found != exportIndices_.end()) {
+      return found->second;
+    }
+    
+    return std::nullopt;
+  }
+  
+  /**
+   * Links imports of the module from specified import object in a single pass, using
+   * the plan cached for the runtime.
+   *
+   * Throws `LinkError` when the import object does not provide all imports.
+   */
+  LinkedImports link(
+    facebook::jsi::Runtime& rt,
+    const facebook::jsi::Object& importObject,
+    ModuleRuntimeCache& cache
+  ) const {
+    if (!cache.importPlan.has_value()) {
+      cache.importPlan.emplace(rt, imports_);
+    }
+
+    return cache.importPlan->link(rt, importObject);
+  }
+
+  /**
+   * Creates context of a module instance, linking its imports with `link()`.
+   *
+   * The instance must then be instantiated with `ModuleContext::instantiate()`, and exposed
+   * to JavaScript with `ModuleContext::attach()`.
+   *
+   * Throws `LinkError` when the import object does not provide all imports.
+   */
+  std::shared_ptr<ModuleContext> createInstance(
+    facebook::jsi::Runtime& rt,
+    facebook::jsi::Object&& importObject,
+    ModuleRuntimeCache& cache
+  ) const {
+    auto imports = link(rt, importObject, cache);
+    return factory_(rt, std::move(importObject), std::move(imports));
+  }
+
+  /**
+   * Returns values cached for this module in specified runtime, if they are still alive.
+   */
+  std::shared_ptr<ModuleRuntimeCache> getRuntimeCache(facebook::jsi::Runtime& rt) const {
+    std::lock_guard lock { runtimeCachesMutex_ };
+    if (auto found = runtimeCaches_.find(&rt); found != runtimeCaches_.end()) {
+      return found->second.lock();
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * Registers values cached for this module in specified runtime.
+   *
+   * The module does not own the cache, as it may outlive the runtime. The owner must
+   * release it before the runtime is destroyed.
+   */
+  void setRuntimeCache(facebook::jsi::Runtime& rt, std::weak_ptr<ModuleRuntimeCache> cache) const {
+    std::lock_guard lock { runtimeCachesMutex_ };
+
+    // Drop entries of destroyed runtimes
+    std::erase_if(runtimeCaches_, [](const auto& entry) { return entry.second.expired(); });
+    runtimeCaches_.insert_or_assign(&rt, std::move(cache));
   }
   
 protected:
-  std::string name_;
-  std::vector<Import> imports_;
-  std::vector<Export> exports_;
+  std::string_view name_;
+  std::span<const Import> imports_;
+  std::span<const Export> exports_;
+  std::unordered_map<std::string_view, size_t> exportIndices_;
   Factory factory_;
-};
+  
+private:
+  void indexExports() {
+    exportIndices_.reserve(exports_.size());
+    for (size_t i = 0; i < exports_.size(); i++) {
+      exportIndices_.emplace(exports_[i].name, i);
+    }
+  }
 
+  mutable std::mutex runtimeCachesMutex_;
+  mutable std::unordered_map<facebook::jsi::Runtime*, std::weak_ptr<ModuleRuntimeCache>> runtimeCaches_;
+};
 }
@@ -10,8 +10,4 @@ namespace callstack::polygen {
 
 TrapError::TrapError(wasm_rt_trap_t type): std::runtime_error(wasm_rt_strerror(type)), type(type) {}
 
-void polygen_trap_handler(wasm_rt_trap_t trap) {
-  throw TrapError(trap);
-}
-
 }
@@ -29,9 +29,5 @@ public:
   explicit TrapError(wasm_rt_trap_t type);
 };
 
-extern "C"
-[[noreturn]]
-void polygen_trap_handler(wasm_rt_trap_t trap);
-
 }
 
@@ -6,10 +6,14 @@
  */
 #pragma once
 #include <cinttypes>
+#include <optional>
 #include <type_traits>
 #include <jsi/jsi.h>
 
-#define INIT_IMPORT_CTX(field, importName) field{&rootCtx, rt, this->importObject.getPropertyAsObject(rt, importName)}
+/**
+ * Initializes import context with imported module object resolved by `ImportPlan`.
+ */
+#define INIT_IMPORT_CTX(field, importName) field{&rootCtx, rt, linkedImports.takeModule(importName)}
 
 #define HOSTFN(name, argCount)         \
   jsi::Function::createFromHostFunction( \
@@ -44,4 +48,40 @@ T coerceToNumber(const facebook::jsi::Value& value) {
   return (T)value.asNumber();
 }
 
+/**
+ * Converts JSI value to 64-bit integer, wrapping `BigInt` values like `BigInt.asIntN(64)`.
+ *
+ * Numbers are accepted as well, for compatibility with code passing 64-bit integers as numbers.
+ */
+inline int64_t coerceToInt64(facebook::jsi::Runtime& rt, const facebook::jsi::Value& value) {
+  if (value.isBigInt()) [[likely]] {
+    return value.getBigInt(rt).getInt64(rt);
+  }
+
+  return coerceToNumber<int64_t>(value);
+}
+
+/**
+ * Looks up imported function by name in import object.
+ *
+ * Returns empty optional if the property is missing or is not a function.
+ */
+inline std::optional<facebook::jsi::Function> resolveImportedFunction(
+  facebook::jsi::Runtime& rt,
+  const facebook::jsi::Object& importObj,
+  const char* name
+) {
+  auto value = importObj.getProperty(rt, name);
+  if (!value.isObject()) {
+    return std::nullopt;
+  }
+  
+  auto obj = value.asObject(rt);
+  if (!obj.isFunction(rt)) {
+    return std::nullopt;
+  }
+  
+  return obj.asFunction(rt);
+}
+
 };
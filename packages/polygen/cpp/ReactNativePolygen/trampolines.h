@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <bit>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <jsi/jsi.h>
+#include <ReactNativePolygen/gen-utils.h>
+#include <ReactNativePolygen/ModuleContext.h>
+#include <ReactNativePolygen/NativeStateHelper.h>
+#include <ReactNativePolygen/TrapBoundary.h>
+
+namespace callstack::polygen {
+
+/**
+ * Converts between JavaScript numbers and native types used by wasm2c for WebAssembly values.
+ *
+ * Integers are exchanged with JavaScript as signed values, same as in the WebAssembly JS API.
+ */
+template <typename T>
+struct WasmValue;
+
+template <>
+struct WasmValue<u32> {
+  static u32 fromNumber(double number) {
+    return std::bit_cast<u32>((s32)number);
+  }
+
+  static double toNumber(u32 value) {
+    return (double)std::bit_cast<s32>(value);
+  }
+};
+
+template <>
+struct WasmValue<u64> {
+  static u64 fromNumber(double number) {
+    return std::bit_cast<u64>((s64)number);
+  }
+
+  static double toNumber(u64 value) {
+    return (double)std::bit_cast<s64>(value);
+  }
+};
+
+template <>
+struct WasmValue<f32> {
+  static f32 fromNumber(double number) {
+    return (f32)number;
+  }
+
+  static double toNumber(f32 value) {
+    return (double)value;
+  }
+};
+
+template <>
+struct WasmValue<f64> {
+  static f64 fromNumber(double number) {
+    return number;
+  }
+
+  static double toNumber(f64 value) {
+    return value;
+  }
+};
+
+/**
+ * Converts native WebAssembly value to JSI value.
+ *
+ * 64-bit integers are passed as `BigInt`, so they do not lose precision.
+ */
+template <typename T>
+inline facebook::jsi::Value toJSIValue(facebook::jsi::Runtime& rt, T value) {
+  if constexpr (std::is_same_v<T, u64>) {
+    return facebook::jsi::BigInt::fromInt64(rt, std::bit_cast<s64>(value));
+  } else {
+    return { WasmValue<T>::toNumber(value) };
+  }
+}
+
+/**
+ * Converts JSI value to native WebAssembly value, coercing non-number values.
+ *
+ * 64-bit integers are read from `BigInt` values, see `coerceToInt64()`.
+ */
+template <typename T>
+inline T fromJSIValue(facebook::jsi::Runtime& rt, const facebook::jsi::Value& value) {
+  if constexpr (std::is_same_v<T, u64>) {
+    return std::bit_cast<u64>(coerceToInt64(rt, value));
+  } else {
+    if (value.isNumber()) [[likely]] {
+      return WasmValue<T>::fromNumber(value.getNumber());
+    }
+
+    return WasmValue<T>::fromNumber(coerceToNumber<double>(value));
+  }
+}
+
+/**
+ * Calls wasm2c generated function with arguments passed from JavaScript.
+ *
+ * The trampoline is specialized on function signature, so every exported function
+ * of the same shape shares single instantiation.
+ */
+template <typename TSignature>
+struct ExportTrampoline;
+
+template <typename TRoot, typename TResult, typename... TParams>
+struct ExportTrampoline<TResult(TRoot*, TParams...)> {
+  using FunctionPtr = TResult (*)(TRoot*, TParams...);
+
+  static constexpr size_t kParamCount = sizeof...(TParams);
+  static constexpr size_t kResultCount = std::is_void_v<TResult> ? 0 : 1;
+
+  static facebook::jsi::Value invoke(facebook::jsi::Runtime& rt, FunctionPtr fn, TRoot* root, const facebook::jsi::Value* args, size_t count) {
+    return invokeWithArgs(rt, fn, root, args, count, std::index_sequence_for<TParams...>{});
+  }
+
+  /**
+   * Calls the function `count` times, without crossing back to JavaScript.
+   *
+   * Arguments of consecutive calls are read from `args`, each taking `kParamCount` elements,
+   * and results are written to `results`, each taking `kResultCount` elements.
+   */
+  static void invokeBatch(FunctionPtr fn, TRoot* root, std::span<const double> args, std::span<double> results, size_t count) {
+    // Values above 2^53 would lose precision as doubles
+    static_assert(!std::is_same_v<TResult, u64> && !(std::is_same_v<TParams, u64> || ...),
+      "Functions with 64-bit integers cannot be called in batch");
+
+    if (args.size() < count * kParamCount || results.size() < count * kResultCount) [[unlikely]] {
+      throw BatchCallError { "Arguments or results buffer is too small for the requested number of calls" };
+    }
+
+    // Single trap boundary covers all calls of the batch
+    callWithTrapBoundary([&] {
+      invokeBatchWithArgs(fn, root, args.data(), results.data(), count, std::index_sequence_for<TParams...>{});
+    });
+  }
+
+private:
+  template <size_t... I>
+  static facebook::jsi::Value invokeWithArgs(facebook::jsi::Runtime& rt, FunctionPtr fn, TRoot* root, const facebook::jsi::Value* args, size_t count, std::index_sequence<I...>) {
+    if (count >= sizeof...(TParams)) [[likely]] {
+      return call(rt, fn, root, fromJSIValue<TParams>(rt, args[I])...);
+    }
+
+    // Missing arguments are `undefined`, which is coerced to zero
+    return call(rt, fn, root, (I < count ? fromJSIValue<TParams>(rt, args[I]) : TParams{})...);
+  }
+
+  template <size_t... I>
+  static void invokeBatchWithArgs(FunctionPtr fn, TRoot* root, const double* args, double* results, size_t count, std::index_sequence<I...>) {
+    for (size_t i = 0; i < count; i++, args += kParamCount) {
+      if constexpr (std::is_void_v<TResult>) {
+        fn(root, WasmValue<TParams>::fromNumber(args[I])...);
+      } else {
+        results[i] = WasmValue<TResult>::toNumber(fn(root, WasmValue<TParams>::fromNumber(args[I])...));
+      }
+    }
+  }
+
+  static facebook::jsi::Value call(facebook::jsi::Runtime& rt, FunctionPtr fn, TRoot* root, TParams... params) {
+    if constexpr (std::is_void_v<TResult>) {
+      callWithTrapBoundary([&] { fn(root, params...); });
+      return facebook::jsi::Value::undefined();
+    } else {
+      return toJSIValue<TResult>(rt, callWithTrapBoundary([&] { return fn(root, params...); }));
+    }
+  }
+};
+
+/**
+ * Resolves module instance an exported function was called on from `this` value.
+ *
+ * Exported functions are shared by all instances of a module, and are bound
+ * to an object holding the instance as native state.
+ */
+template <typename TContext>
+std::shared_ptr<TContext> getExportContext(facebook::jsi::Runtime& rt, const facebook::jsi::Value& thisValue) {
+  if (!thisValue.isObject()) [[unlikely]] {
+    throw facebook::jsi::JSError(rt, "Exported WebAssembly function was called without an instance");
+  }
+
+  return NativeStateHelper::tryGet<TContext>(rt, thisValue.getObject(rt));
+}
+
+/**
+ * Creates JS function calling exported WebAssembly function `fn` on the instance it is bound to.
+ *
+ * Created function does not capture any instance, and can be shared by all instances of the module.
+ */
+template <typename TContext, typename TRoot, typename TResult, typename... TParams>
+facebook::jsi::Function createExportFunction(
+  facebook::jsi::Runtime& rt,
+  const char* name,
+  TResult (*fn)(TRoot*, TParams...)
+) {
+  using Trampoline = ExportTrampoline<TResult(TRoot*, TParams...)>;
+
+  return facebook::jsi::Function::createFromHostFunction(
+    rt,
+    facebook::jsi::PropNameID::forAscii(rt, name),
+    sizeof...(TParams),
+    [fn](facebook::jsi::Runtime& rt, const facebook::jsi::Value& thisValue, const facebook::jsi::Value* args, size_t count) -> facebook::jsi::Value {
+      auto inst = getExportContext<TContext>(rt, thisValue);
+      return Trampoline::invoke(rt, fn, &inst->rootCtx, args, count);
+    }
+  );
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#include "MappedFile.h"
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace callstack::polygen {
+
+namespace {
+
+/**
+ * Size of chunks hashed before their pages are released, a multiple of any page size.
+ */
+constexpr size_t kHashChunkSize = 1024 * 1024;
+
+}
+
+MappedFile::MappedFile(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::system_error(errno, std::generic_category(), "Failed to open '" + path + "'");
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    auto error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category(), "Failed to stat '" + path + "'");
+  }
+
+  size_ = (size_t)fileStat.st_size;
+#if defined(__APPLE__)
+  auto modified = fileStat.st_mtimespec;
+#else
+  auto modified = fileStat.st_mtim;
+#endif
+  identity_ = {
+    .device = (uint64_t)fileStat.st_dev,
+    .inode = (uint64_t)fileStat.st_ino,
+    .size = (uint64_t)fileStat.st_size,
+    .modifiedSeconds = (int64_t)modified.tv_sec,
+    .modifiedNanoseconds = (int64_t)modified.tv_nsec,
+  };
+
+  if (size_ == 0) {
+    // Empty files cannot be mapped, and are treated as empty contents
+    ::close(fd);
+    return;
+  }
+
+  void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  auto error = errno;
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::system_error(error, std::generic_category(), "Failed to map '" + path + "'");
+  }
+
+  data_ = (uint8_t*)data;
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+}
+
+ModuleChecksum MappedFile::computeSHA256() const {
+  SHA256 hasher;
+  for (size_t offset = 0; offset < size_; offset += kHashChunkSize) {
+    auto length = std::min(kHashChunkSize, size_ - offset);
+    hasher.update({ data_ + offset, length });
+    madvise(data_ + offset, length, MADV_DONTNEED);
+  }
+  return hasher.finalize();
+}
+
+}
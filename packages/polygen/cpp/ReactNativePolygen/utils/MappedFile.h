@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <span>
+#include <string>
+#include <cinttypes>
+#include <ReactNativePolygen/utils/checksum.h>
+
+namespace callstack::polygen {
+
+/**
+ * Identity of a file on disk, changing whenever the file is replaced or modified.
+ */
+struct FileIdentity {
+  uint64_t device;
+  uint64_t inode;
+  uint64_t size;
+  int64_t modifiedSeconds;
+  int64_t modifiedNanoseconds;
+
+  bool operator==(const FileIdentity&) const = default;
+};
+
+/**
+ * Read-only memory mapping of a whole file, unmapped when destroyed.
+ */
+class MappedFile final {
+public:
+  /**
+   * Maps file at specified path.
+   *
+   * Throws `std::system_error` if the file cannot be opened or mapped.
+   */
+  explicit MappedFile(const std::string& path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * Returns contents of the file.
+   *
+   * The mapping is read-only, so the contents must not be written to.
+   */
+  std::span<uint8_t> getContents() const {
+    return { data_, size_ };
+  }
+
+  /**
+   * Computes SHA-256 digest of the contents.
+   *
+   * Pages are released as soon as they are hashed, so the whole file is never resident at once.
+   */
+  ModuleChecksum computeSHA256() const;
+
+  /**
+   * Returns identity of the mapped file, as it was when the file was opened.
+   */
+  const FileIdentity& getIdentity() const {
+    return identity_;
+  }
+
+private:
+  uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  FileIdentity identity_ {};
+};
+
+}
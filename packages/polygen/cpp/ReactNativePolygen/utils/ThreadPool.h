@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace callstack::polygen {
+
+/**
+ * Fixed-size pool of worker threads running submitted tasks in order.
+ *
+ * Tasks already submitted are completed before the pool is destroyed.
+ */
+class ThreadPool final {
+public:
+  /**
+   * Starts `threadCount` threads, each calling `onThreadStart` before running any task,
+   * and `onThreadExit` once the pool is destroyed.
+   */
+  explicit ThreadPool(
+    size_t threadCount,
+    std::function<void()> onThreadStart = nullptr,
+    std::function<void()> onThreadExit = nullptr
+  ) : onThreadStart_(std::move(onThreadStart)), onThreadExit_(std::move(onThreadExit)) {
+    threads_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+      threads_.emplace_back([this]() {
+        if (onThreadStart_) {
+          onThreadStart_();
+        }
+        run();
+        if (onThreadExit_) {
+          onThreadExit_();
+        }
+      });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    condition_.notify_all();
+
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  void submit(std::function<void()> task) {
+    {
+      std::lock_guard lock(mutex_);
+      tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+  }
+
+private:
+  void run() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock(mutex_);
+        condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+
+      task();
+    }
+  }
+
+  std::function<void()> onThreadStart_;
+  std::function<void()> onThreadExit_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopping_ = false;
+};
+
+}
@@ -5,13 +5,368 @@
  * LICENSE file in the root directory of this source tree.
  */
 #include "checksum.h"
-#include "hashpp.h"
+#include "xxhash.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Disables hardware acceleration of SHA-256, e.g. to compare with the portable implementation
+#ifndef POLYGEN_SHA256_PORTABLE
+#define POLYGEN_SHA256_PORTABLE 0
+#endif
+
+#if POLYGEN_SHA256_PORTABLE
+// Only the portable implementation is compiled
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define POLYGEN_SHA256_X86_SHANI 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+#define POLYGEN_SHA256_ARMV8 1
+#include <arm_neon.h>
+#endif
 
 namespace callstack::polygen {
 
-std::string computeSHA256(std::span<uint8_t> buffer) {
-  auto hash = hashpp::get::getHash(hashpp::ALGORITHMS::SHA2_256, {(char*)buffer.data(), buffer.size()});
-  return hash.getString();
+namespace {
+
+constexpr std::array<uint32_t, 8> kInitialState = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+alignas(16) constexpr uint32_t kRoundConstants[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+using CompressFunction = void (*)(uint32_t* state, const uint8_t* data, size_t blockCount);
+
+inline uint32_t rotr(uint32_t x, int n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+inline uint32_t loadBigEndian32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+void compressPortable(uint32_t* state, const uint8_t* data, size_t blockCount) {
+  uint32_t w[64];
+  for (; blockCount > 0; blockCount--, data += 64) {
+    for (int i = 0; i < 16; i++) {
+      w[i] = loadBigEndian32(data + 4 * i);
+    }
+    for (int i = 16; i < 64; i++) {
+      auto s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      auto s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; i++) {
+      auto t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + kRoundConstants[i] + w[i];
+      auto t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+      h = g; g = f; f = e; e = d + t1;
+      d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+  }
+}
+
+#if POLYGEN_SHA256_X86_SHANI
+/**
+ * Compresses blocks using Intel SHA extensions.
+ *
+ * SHA instructions operate on state split into ABEF and CDGH halves, so the state
+ * is shuffled into that layout before processing and back after it.
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+void compressSHANI(uint32_t* state, const uint8_t* data, size_t blockCount) {
+  const __m128i byteSwapMask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+  __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[0]), 0xB1);
+  __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[4]), 0x1B);
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+  for (; blockCount > 0; blockCount--, data += 64) {
+    const __m128i savedState0 = state0;
+    const __m128i savedState1 = state1;
+
+    __m128i m[4];
+    #pragma GCC unroll 16
+    for (int i = 0; i < 16; i++) {
+      if (i < 4) {
+        m[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16 * i)), byteSwapMask);
+      } else {
+        // W[t] = σ1(W[t-2]) + W[t-7] + σ0(W[t-15]) + W[t-16], four words at a time
+        auto next = _mm_sha256msg1_epu32(m[i & 3], m[(i + 1) & 3]);
+        next = _mm_add_epi32(next, _mm_alignr_epi8(m[(i + 3) & 3], m[(i + 2) & 3], 4));
+        m[i & 3] = _mm_sha256msg2_epu32(next, m[(i + 3) & 3]);
+      }
+
+      auto msg = _mm_add_epi32(m[i & 3], _mm_load_si128((const __m128i*)&kRoundConstants[4 * i]));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));
+    }
+
+    state0 = _mm_add_epi32(state0, savedState0);
+    state1 = _mm_add_epi32(state1, savedState1);
+  }
+
+  tmp = _mm_shuffle_epi32(state0, 0x1B);
+  state1 = _mm_shuffle_epi32(state1, 0xB1);
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+  state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+  _mm_storeu_si128((__m128i*)&state[0], state0);
+  _mm_storeu_si128((__m128i*)&state[4], state1);
+}
+
+bool isSHANISupported() {
+  unsigned eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+  bool hasSSSE3 = ecx & bit_SSSE3;
+  bool hasSSE41 = ecx & bit_SSE4_1;
+
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+  bool hasSHA = ebx & (1u << 29);
+
+  return hasSSSE3 && hasSSE41 && hasSHA;
+}
+#endif
+
+#if POLYGEN_SHA256_ARMV8
+/**
+ * Compresses blocks using ARMv8 cryptography extensions.
+ */
+void compressARMv8(uint32_t* state, const uint8_t* data, size_t blockCount) {
+  uint32x4_t state0 = vld1q_u32(&state[0]);
+  uint32x4_t state1 = vld1q_u32(&state[4]);
+
+  for (; blockCount > 0; blockCount--, data += 64) {
+    const uint32x4_t savedState0 = state0;
+    const uint32x4_t savedState1 = state1;
+
+    uint32x4_t m[4];
+    for (int i = 0; i < 4; i++) {
+      m[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+    }
+
+    #pragma GCC unroll 16
+    for (int i = 0; i < 16; i++) {
+      auto msg = vaddq_u32(m[i & 3], vld1q_u32(&kRoundConstants[4 * i]));
+      if (i < 12) {
+        m[i & 3] = vsha256su1q_u32(vsha256su0q_u32(m[i & 3], m[(i + 1) & 3]), m[(i + 2) & 3], m[(i + 3) & 3]);
+      }
+
+      auto previousState0 = state0;
+      state0 = vsha256hq_u32(state0, state1, msg);
+      state1 = vsha256h2q_u32(state1, previousState0, msg);
+    }
+
+    state0 = vaddq_u32(state0, savedState0);
+    state1 = vaddq_u32(state1, savedState1);
+  }
+
+  vst1q_u32(&state[0], state0);
+  vst1q_u32(&state[4], state1);
+}
+#endif
+
+CompressFunction selectCompressFunction() {
+#if POLYGEN_SHA256_X86_SHANI
+  if (isSHANISupported()) {
+    return compressSHANI;
+  }
+#elif POLYGEN_SHA256_ARMV8
+  return compressARMv8;
+#endif
+  return compressPortable;
+}
+
+const CompressFunction compress = selectCompressFunction();
+
+}
+
+SHA256::SHA256(): state_(kInitialState) {}
+
+void SHA256::processBlocks(const uint8_t* data, size_t blockCount) {
+  compress(state_.data(), data, blockCount);
+}
+
+void SHA256::update(std::span<const uint8_t> data) {
+  totalSize_ += data.size();
+
+  if (bufferSize_ > 0) {
+    auto count = std::min(buffer_.size() - bufferSize_, data.size());
+    std::memcpy(buffer_.data() + bufferSize_, data.data(), count);
+    bufferSize_ += count;
+    data = data.subspan(count);
+
+    if (bufferSize_ < buffer_.size()) {
+      return;
+    }
+    processBlocks(buffer_.data(), 1);
+    bufferSize_ = 0;
+  }
+
+  auto blockCount = data.size() / buffer_.size();
+  if (blockCount > 0) {
+    processBlocks(data.data(), blockCount);
+    data = data.subspan(blockCount * buffer_.size());
+  }
+
+  std::memcpy(buffer_.data(), data.data(), data.size());
+  bufferSize_ = data.size();
+}
+
+ModuleChecksum SHA256::finalize() {
+  auto bitLength = totalSize_ * 8;
+
+  buffer_[bufferSize_++] = 0x80;
+  if (bufferSize_ > buffer_.size() - 8) {
+    std::memset(buffer_.data() + bufferSize_, 0, buffer_.size() - bufferSize_);
+    processBlocks(buffer_.data(), 1);
+    bufferSize_ = 0;
+  }
+  std::memset(buffer_.data() + bufferSize_, 0, buffer_.size() - 8 - bufferSize_);
+  for (int i = 0; i < 8; i++) {
+    buffer_[buffer_.size() - 1 - i] = (uint8_t)(bitLength >> (8 * i));
+  }
+  processBlocks(buffer_.data(), 1);
+
+  ModuleChecksum digest;
+  for (size_t i = 0; i < state_.size(); i++) {
+    digest[4 * i] = (uint8_t)(state_[i] >> 24);
+    digest[4 * i + 1] = (uint8_t)(state_[i] >> 16);
+    digest[4 * i + 2] = (uint8_t)(state_[i] >> 8);
+    digest[4 * i + 3] = (uint8_t)state_[i];
+  }
+
+  *this = SHA256();
+  return digest;
+}
+
+ModuleChecksum computeSHA256(std::span<const uint8_t> buffer) {
+  SHA256 hasher;
+  hasher.update(buffer);
+  return hasher.finalize();
+}
+
+namespace {
+
+constexpr std::array<uint8_t, 8> kWasmPreamble = { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00 };
+constexpr size_t kFingerprintBlockSize = 256;
+constexpr size_t kFingerprintSampledBlockCount = 16;
+constexpr size_t kFingerprintSampleSize = kFingerprintBlockSize * (kFingerprintSampledBlockCount + 1);
+
+uint64_t computeContentHash(std::span<const uint8_t> moduleData) {
+  if (moduleData.size() <= kFingerprintSampleSize) {
+    return computeXXH3(moduleData);
+  }
+
+  // Header block is followed by blocks spread evenly over the rest, the last one ending the module
+  std::array<uint8_t, kFingerprintSampleSize> sample;
+  std::memcpy(sample.data(), moduleData.data(), kFingerprintBlockSize);
+
+  uint64_t sampledRange = moduleData.size() - 2 * kFingerprintBlockSize;
+  for (size_t i = 0; i < kFingerprintSampledBlockCount; i++) {
+    auto offset = kFingerprintBlockSize + sampledRange * i / (kFingerprintSampledBlockCount - 1);
+    std::memcpy(sample.data() + kFingerprintBlockSize * (i + 1), moduleData.data() + offset, kFingerprintBlockSize);
+  }
+
+  return computeXXH3(sample);
+}
+
+std::optional<uint64_t> computeLayoutHash(std::span<const uint8_t> moduleData) {
+  // Each section is recorded as its id followed by its little-endian 32-bit size
+  std::vector<uint8_t> layout;
+  size_t offset = kWasmPreamble.size();
+  while (offset < moduleData.size()) {
+    auto sectionId = moduleData[offset++];
+
+    uint32_t sectionSize = 0;
+    for (int shift = 0;; shift += 7) {
+      if (offset >= moduleData.size() || shift > 28) {
+        return std::nullopt;
+      }
+      auto byte = moduleData[offset++];
+      sectionSize |= (uint32_t)(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        break;
+      }
+    }
+
+    if (sectionSize > moduleData.size() - offset) {
+      return std::nullopt;
+    }
+    offset += sectionSize;
+
+    layout.push_back(sectionId);
+    for (int i = 0; i < 4; i++) {
+      layout.push_back((uint8_t)(sectionSize >> (8 * i)));
+    }
+  }
+
+  return computeXXH3(layout);
+}
+
+}
+
+std::optional<ModuleFingerprint> computeModuleFingerprint(std::span<const uint8_t> moduleData) {
+  if (moduleData.size() < kWasmPreamble.size()
+      || !std::equal(kWasmPreamble.begin(), kWasmPreamble.end(), moduleData.begin())) {
+    return std::nullopt;
+  }
+
+  auto layoutHash = computeLayoutHash(moduleData);
+  if (!layoutHash.has_value()) {
+    return std::nullopt;
+  }
+
+  return ModuleFingerprint {
+    .size = moduleData.size(),
+    .contentHash = computeContentHash(moduleData),
+    .layoutHash = *layoutHash,
+  };
+}
+
+std::optional<ModuleChecksum> parseChecksum(std::string_view hex) {
+  if (hex.size() != 2 * std::tuple_size_v<ModuleChecksum>) {
+    return std::nullopt;
+  }
+
+  auto digitValue = [](char c) -> int {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  };
+
+  ModuleChecksum checksum;
+  for (size_t i = 0; i < checksum.size(); i++) {
+    auto high = digitValue(hex[2 * i]);
+    auto low = digitValue(hex[2 * i + 1]);
+    if (high < 0 || low < 0) {
+      return std::nullopt;
+    }
+    checksum[i] = (uint8_t)((high << 4) | low);
+  }
+
+  return checksum;
 }
 
 }
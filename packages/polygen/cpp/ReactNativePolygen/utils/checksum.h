@@ -6,12 +6,82 @@
  */
 #pragma once
 
-#include <vector>
+#include <array>
+#include <optional>
+#include <string_view>
 #include <span>
 #include <cinttypes>
 
 namespace callstack::polygen {
 
-std::string computeSHA256(std::span<uint8_t> buffer);
+/**
+ * Raw SHA-256 digest of a module binary.
+ */
+using ModuleChecksum = std::array<uint8_t, 32>;
+
+/**
+ * Cheap fingerprint of a module binary, used to find the candidate module before
+ * verifying its checksum.
+ *
+ * Must be kept in sync with `computeModuleFingerprint()` in codegen `helpers/fingerprint.ts`.
+ */
+struct ModuleFingerprint {
+  /**
+   * Size of the module in bytes.
+   */
+  uint64_t size;
+
+  /**
+   * XXH3 hash of the module header and blocks sampled evenly from the rest of the module.
+   */
+  uint64_t contentHash;
+
+  /**
+   * XXH3 hash of the section layout, as a list of section ids and sizes.
+   */
+  uint64_t layoutHash;
+
+  bool operator==(const ModuleFingerprint&) const = default;
+};
+
+/**
+ * Streaming SHA-256 implementation.
+ *
+ * Data is hashed in place, using SHA extensions of x86-64 or ARMv8 processors when available.
+ */
+class SHA256 {
+public:
+  SHA256();
+
+  void update(std::span<const uint8_t> data);
+  ModuleChecksum finalize();
+
+private:
+  void processBlocks(const uint8_t* data, size_t blockCount);
+
+  std::array<uint32_t, 8> state_;
+  std::array<uint8_t, 64> buffer_;
+  size_t bufferSize_ = 0;
+  uint64_t totalSize_ = 0;
+};
+
+/**
+ * Computes SHA-256 digest of the buffer.
+ */
+ModuleChecksum computeSHA256(std::span<const uint8_t> buffer);
+
+/**
+ * Computes fingerprint of a WebAssembly module binary.
+ *
+ * Only touches the module header, sampled blocks and section headers, so it takes
+ * roughly constant time regardless of the module size. Returns empty optional if the
+ * buffer is not a well-formed sequence of WebAssembly sections.
+ */
+std::optional<ModuleFingerprint> computeModuleFingerprint(std::span<const uint8_t> moduleData);
+
+/**
+ * Parses hex-encoded SHA-256 digest. Returns empty optional if the string is not a valid digest.
+ */
+std::optional<ModuleChecksum> parseChecksum(std::string_view hex);
 
 };
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#include "xxhash.h"
+#include <cstring>
+
+namespace callstack::polygen {
+
+namespace {
+
+constexpr uint32_t kPrime32_1 = 0x9E3779B1u;
+constexpr uint32_t kPrime32_2 = 0x85EBCA77u;
+constexpr uint32_t kPrime32_3 = 0xC2B2AE3Du;
+constexpr uint64_t kPrime64_1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t kPrime64_3 = 0x165667B19E3779F9ull;
+constexpr uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t kPrime64_5 = 0x27D4EB2F165667C5ull;
+
+constexpr size_t kStripeSize = 64;
+constexpr size_t kSecretConsumeRate = 8;
+constexpr size_t kAccumulatorCount = 8;
+constexpr size_t kSecretMergeAccsStart = 11;
+constexpr size_t kSecretLastAccStart = 7;
+constexpr size_t kMidSizeMax = 240;
+constexpr size_t kSecretSizeMin = 136;
+
+constexpr uint8_t kSecret[192] = {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+inline uint32_t read32(const uint8_t* p) {
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint64_t read64(const uint8_t* p) {
+  uint64_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint64_t rotl64(uint64_t x, int n) {
+  return (x << n) | (x >> (64 - n));
+}
+
+inline uint64_t mul128Fold64(uint64_t lhs, uint64_t rhs) {
+#if defined(__SIZEOF_INT128__)
+  auto product = (unsigned __int128)lhs * rhs;
+  return (uint64_t)product ^ (uint64_t)(product >> 64);
+#else
+  uint64_t loLo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+  uint64_t hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+  uint64_t loHi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+  uint64_t hiHi = (lhs >> 32) * (rhs >> 32);
+  uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+  uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+  uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFF);
+  return lower ^ upper;
+#endif
+}
+
+inline uint64_t xxh64Avalanche(uint64_t h) {
+  h ^= h >> 33;
+  h *= kPrime64_2;
+  h ^= h >> 29;
+  h *= kPrime64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+inline uint64_t avalanche(uint64_t h) {
+  h ^= h >> 37;
+  h *= 0x165667919E3779F9ull;
+  h ^= h >> 32;
+  return h;
+}
+
+inline uint64_t rrmxmx(uint64_t h, uint64_t length) {
+  h ^= rotl64(h, 49) ^ rotl64(h, 24);
+  h *= 0x9FB21C651E98DF25ull;
+  h ^= (h >> 35) + length;
+  h *= 0x9FB21C651E98DF25ull;
+  h ^= h >> 28;
+  return h;
+}
+
+inline uint64_t mix16(const uint8_t* input, const uint8_t* secret) {
+  return mul128Fold64(read64(input) ^ read64(secret), read64(input + 8) ^ read64(secret + 8));
+}
+
+uint64_t hash0To16(const uint8_t* input, size_t length) {
+  if (length > 8) {
+    auto lo = read64(input) ^ (read64(kSecret + 24) ^ read64(kSecret + 32));
+    auto hi = read64(input + length - 8) ^ (read64(kSecret + 40) ^ read64(kSecret + 48));
+    auto acc = length + __builtin_bswap64(lo) + hi + mul128Fold64(lo, hi);
+    return avalanche(acc);
+  }
+  if (length >= 4) {
+    auto combined = (uint64_t)read32(input + length - 4) + ((uint64_t)read32(input) << 32);
+    return rrmxmx(combined ^ (read64(kSecret + 8) ^ read64(kSecret + 16)), length);
+  }
+  if (length > 0) {
+    uint32_t combined = ((uint32_t)input[0] << 16) | ((uint32_t)input[length >> 1] << 24)
+      | (uint32_t)input[length - 1] | ((uint32_t)length << 8);
+    return xxh64Avalanche(combined ^ (uint64_t)(read32(kSecret) ^ read32(kSecret + 4)));
+  }
+  return xxh64Avalanche(read64(kSecret + 56) ^ read64(kSecret + 64));
+}
+
+uint64_t hash17To128(const uint8_t* input, size_t length) {
+  uint64_t acc = length * kPrime64_1;
+  if (length > 32) {
+    if (length > 64) {
+      if (length > 96) {
+        acc += mix16(input + 48, kSecret + 96);
+        acc += mix16(input + length - 64, kSecret + 112);
+      }
+      acc += mix16(input + 32, kSecret + 64);
+      acc += mix16(input + length - 48, kSecret + 80);
+    }
+    acc += mix16(input + 16, kSecret + 32);
+    acc += mix16(input + length - 32, kSecret + 48);
+  }
+  acc += mix16(input, kSecret);
+  acc += mix16(input + length - 16, kSecret + 16);
+  return avalanche(acc);
+}
+
+uint64_t hash129To240(const uint8_t* input, size_t length) {
+  uint64_t acc = length * kPrime64_1;
+  size_t roundCount = length / 16;
+  for (size_t i = 0; i < 8; i++) {
+    acc += mix16(input + 16 * i, kSecret + 16 * i);
+  }
+  acc = avalanche(acc);
+  for (size_t i = 8; i < roundCount; i++) {
+    acc += mix16(input + 16 * i, kSecret + 16 * (i - 8) + 3);
+  }
+  acc += mix16(input + length - 16, kSecret + kSecretSizeMin - 17);
+  return avalanche(acc);
+}
+
+inline void accumulateStripe(uint64_t* acc, const uint8_t* input, const uint8_t* secret) {
+  for (size_t i = 0; i < kAccumulatorCount; i++) {
+    auto value = read64(input + 8 * i);
+    auto key = value ^ read64(secret + 8 * i);
+    acc[i ^ 1] += value;
+    acc[i] += (key & 0xFFFFFFFF) * (key >> 32);
+  }
+}
+
+inline void scrambleAccumulators(uint64_t* acc, const uint8_t* secret) {
+  for (size_t i = 0; i < kAccumulatorCount; i++) {
+    auto value = acc[i];
+    value ^= value >> 47;
+    value ^= read64(secret + 8 * i);
+    acc[i] = value * kPrime32_1;
+  }
+}
+
+uint64_t hashLong(const uint8_t* input, size_t length) {
+  uint64_t acc[kAccumulatorCount] = {
+    kPrime32_3, kPrime64_1, kPrime64_2, kPrime64_3, kPrime64_4, kPrime32_2, kPrime64_5, kPrime32_1
+  };
+
+  constexpr size_t stripesPerBlock = (sizeof(kSecret) - kStripeSize) / kSecretConsumeRate;
+  constexpr size_t blockSize = kStripeSize * stripesPerBlock;
+  size_t blockCount = (length - 1) / blockSize;
+
+  for (size_t block = 0; block < blockCount; block++) {
+    for (size_t stripe = 0; stripe < stripesPerBlock; stripe++) {
+      accumulateStripe(acc, input + block * blockSize + stripe * kStripeSize, kSecret + stripe * kSecretConsumeRate);
+    }
+    scrambleAccumulators(acc, kSecret + sizeof(kSecret) - kStripeSize);
+  }
+
+  size_t lastStripeCount = ((length - 1) - blockSize * blockCount) / kStripeSize;
+  for (size_t stripe = 0; stripe < lastStripeCount; stripe++) {
+    accumulateStripe(acc, input + blockCount * blockSize + stripe * kStripeSize, kSecret + stripe * kSecretConsumeRate);
+  }
+  accumulateStripe(acc, input + length - kStripeSize, kSecret + sizeof(kSecret) - kStripeSize - kSecretLastAccStart);
+
+  uint64_t result = length * kPrime64_1;
+  for (size_t i = 0; i < 4; i++) {
+    const uint8_t* secret = kSecret + kSecretMergeAccsStart + 16 * i;
+    result += mul128Fold64(acc[2 * i] ^ read64(secret), acc[2 * i + 1] ^ read64(secret + 8));
+  }
+  return avalanche(result);
+}
+
+}
+
+uint64_t computeXXH3(std::span<const uint8_t> buffer) {
+  auto* input = buffer.data();
+  auto length = buffer.size();
+
+  if (length <= 16) {
+    return hash0To16(input, length);
+  }
+  if (length <= 128) {
+    return hash17To128(input, length);
+  }
+  if (length <= kMidSizeMax) {
+    return hash129To240(input, length);
+  }
+  return hashLong(input, length);
+}
+
+}
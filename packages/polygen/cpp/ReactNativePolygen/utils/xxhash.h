@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) callstack.io.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+#pragma once
+
+#include <span>
+#include <cinttypes>
+
+namespace callstack::polygen {
+
+/**
+ * Computes 64-bit XXH3 hash of the buffer, using default secret and zero seed.
+ *
+ * Must be kept in sync with `xxh3()` in codegen `helpers/xxhash.ts`.
+ */
+uint64_t computeXXH3(std::span<const uint8_t> buffer);
+
+};
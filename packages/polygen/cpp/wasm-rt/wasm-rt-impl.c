@@ -42,11 +42,6 @@
 #define DEBUG_PRINTF(...)
 #endif
 
-/**
- * Polygen customisation
- */
-#define WASM_RT_TRAP_HANDLER polygen_trap_handler
-
 #if WASM_RT_INSTALL_SIGNAL_HANDLER
 static bool g_signal_handler_installed = false;
 #ifdef _WIN32
@@ -80,6 +75,72 @@ static WASM_RT_THREAD_LOCAL void* g_alt_stack = NULL;
 
 WASM_RT_THREAD_LOCAL wasm_rt_jmp_buf g_wasm_rt_jmp_buf;
 
+/**
+ * Polygen customisation
+ *
+ * Traps jump back to the trap boundary of the export call (see `TrapBoundary.h`),
+ * which needs access to thread-local state of the runtime.
+ */
+wasm_rt_jmp_buf* polygen_get_trap_jmp_buf(void) {
+    return &g_wasm_rt_jmp_buf;
+}
+
+uint32_t polygen_save_call_stack_depth(void) {
+#if WASM_RT_STACK_DEPTH_COUNT
+    uint32_t previous = wasm_rt_saved_call_stack_depth;
+    wasm_rt_saved_call_stack_depth = wasm_rt_call_stack_depth;
+    return previous;
+#else
+    return 0;
+#endif
+}
+
+void polygen_restore_saved_call_stack_depth(uint32_t depth) {
+#if WASM_RT_STACK_DEPTH_COUNT
+    wasm_rt_saved_call_stack_depth = depth;
+#else
+    (void)depth;
+#endif
+}
+
+/**
+ * Polygen customisation
+ *
+ * Tables with fixed size are allocated from storage held by the instance (see `TableArena.h`),
+ * set for the thread while the module is instantiated or freed. Tables which may grow are
+ * allocated separately, as growing them reallocates their elements.
+ */
+static WASM_RT_THREAD_LOCAL uint8_t* g_table_arena_start = NULL;
+static WASM_RT_THREAD_LOCAL uint8_t* g_table_arena_next = NULL;
+static WASM_RT_THREAD_LOCAL uint8_t* g_table_arena_end = NULL;
+
+void polygen_set_table_arena(void* data, size_t size) {
+    g_table_arena_start = data;
+    g_table_arena_next = data;
+    g_table_arena_end = (uint8_t*)data + size;
+}
+
+static void* polygen_allocate_table_data(uint32_t elements, uint32_t max_elements, size_t element_size) {
+    size_t size = (size_t)elements * element_size;
+    if (elements == max_elements && size > 0 && size <= (size_t)(g_table_arena_end - g_table_arena_next)) {
+        void* data = g_table_arena_next;
+        g_table_arena_next += size;
+        memset(data, 0, size);
+        return data;
+    }
+
+    return calloc(elements, element_size);
+}
+
+static void polygen_free_table_data(void* data) {
+    uintptr_t address = (uintptr_t)data;
+    if (address >= (uintptr_t)g_table_arena_start && address < (uintptr_t)g_table_arena_end) {
+        return;
+    }
+
+    free(data);
+}
+
 #ifdef WASM_RT_TRAP_HANDLER
 extern void WASM_RT_TRAP_HANDLER(wasm_rt_trap_t code);
 #endif
@@ -136,7 +197,11 @@ static void os_signal_handler(int sig, siginfo_t* si, void* unused) {
 static void os_install_signal_handler(void) {
     struct sigaction sa;
     memset(&sa, '\0', sizeof(sa));
-    sa.sa_flags = SA_SIGINFO;
+    /*
+     * Polygen customisation: the signal is not blocked while handling it, so trap boundaries
+     * do not need to save and restore signal mask on every call (see `TrapBoundary.h`).
+     */
+    sa.sa_flags = SA_SIGINFO | SA_NODEFER;
 #if WASM_RT_STACK_EXHAUSTION_HANDLER
     sa.sa_flags |= SA_ONSTACK;
 #endif
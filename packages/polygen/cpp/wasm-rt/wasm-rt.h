@@ -100,6 +100,24 @@ extern "C" {
 #define WASM_RT_SANITY_CHECKS 0
 #endif
 
+/**
+ * Polygen customisation
+ *
+ * Memory check strategy selected using `output.memoryCheck` Polygen option, passed as
+ * `POLYGEN_MEMCHECK_GUARD_PAGES` or `POLYGEN_MEMCHECK_BOUNDS_CHECK`. Guard pages fall
+ * back to bounds checks on hosts that cannot use them.
+ */
+#if defined(POLYGEN_MEMCHECK_GUARD_PAGES) && POLYGEN_MEMCHECK_GUARD_PAGES
+#if UINTPTR_MAX > 0xffffffff && !SUPPORT_MEMORY64 && !WABT_BIG_ENDIAN
+#define WASM_RT_USE_MMAP 1
+#define WASM_RT_MEMCHECK_GUARD_PAGES 1
+#else
+#define WASM_RT_MEMCHECK_BOUNDS_CHECK 1
+#endif
+#elif defined(POLYGEN_MEMCHECK_BOUNDS_CHECK) && POLYGEN_MEMCHECK_BOUNDS_CHECK
+#define WASM_RT_MEMCHECK_BOUNDS_CHECK 1
+#endif
+
 /**
  * Backward compatibility: Convert the previously exposed
  * WASM_RT_MEMCHECK_SIGNAL_HANDLER macro to the ALLOCATION and CHECK macros that
@@ -7,8 +7,19 @@
   facebook::react::registerCxxModuleToGlobalModuleMap(
   std::string(facebook::react::ReactNativePolygen::kModuleName),
   [&](std::shared_ptr<facebook::react::CallInvoker> jsInvoker) {
-  return std::make_shared<facebook::react::ReactNativePolygen>(jsInvoker);
+  return std::make_shared<facebook::react::ReactNativePolygen>(jsInvoker, [Wasm verificationCacheOptions]);
 });
 }
 
++ (facebook::react::VerificationCacheOptions)verificationCacheOptions {
+  NSString *cachesDirectory = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+  NSDictionary *info = [[NSBundle mainBundle] infoDictionary];
+  NSString *appVersion = [NSString stringWithFormat:@"%@ (%@)", info[@"CFBundleShortVersionString"], info[@"CFBundleVersion"]];
+
+  return {
+    .path = [[cachesDirectory stringByAppendingPathComponent:@"polygen-verification.cache"] UTF8String],
+    .appVersion = [appVersion UTF8String],
+  };
+}
+
 @end
@@ -137,6 +137,14 @@ export interface Spec extends TurboModule {
     holder: OpaqueModuleNativeHandle,
     moduleData: UnsafeArrayBuffer
   ): InternalModuleMetadata;
+  loadModuleFromFile(
+    holder: OpaqueModuleNativeHandle,
+    path: string
+  ): InternalModuleMetadata;
+  loadModules(
+    holders: OpaqueModuleNativeHandle[],
+    sources: unknown[]
+  ): Promise<InternalModuleMetadata[]>;
   unloadModule(module: OpaqueModuleNativeHandle): void;
   getModuleMetadata(module: OpaqueModuleNativeHandle): InternalModuleMetadata;
 
@@ -146,7 +154,37 @@ export interface Spec extends TurboModule {
     mod: OpaqueModuleNativeHandle,
     importObject: NativeImportObject
   ): void;
+  createModuleInstanceAsync(
+    holder: OpaqueModuleInstanceNativeHandle,
+    mod: OpaqueModuleNativeHandle,
+    importObject: NativeImportObject
+  ): Promise<void>;
+  createLazyModuleInstance(
+    holder: OpaqueModuleInstanceNativeHandle,
+    mod: OpaqueModuleNativeHandle,
+    importObject: NativeImportObject
+  ): void;
   destroyModuleInstance(instance: OpaqueModuleInstanceNativeHandle): void;
+  resetModuleInstance(instance: OpaqueModuleInstanceNativeHandle): void;
+  rebindModuleInstanceImports(
+    instance: OpaqueModuleInstanceNativeHandle,
+    importObject: NativeImportObject
+  ): void;
+  snapshotModuleInstance(
+    instance: OpaqueModuleInstanceNativeHandle,
+    path: string
+  ): void;
+  restoreModuleInstance(
+    instance: OpaqueModuleInstanceNativeHandle,
+    path: string
+  ): void;
+  callExportBatch(
+    instance: OpaqueModuleInstanceNativeHandle,
+    name: string,
+    args: UnsafeObject,
+    results: UnsafeObject,
+    count: number
+  ): void;
 
   // Memory
   createMemory(
@@ -161,10 +199,10 @@ export interface Spec extends TurboModule {
   createGlobal(
     holder: OpaqueGlobalNativeHandle,
     descriptor: NativeGlobalDescriptor,
-    initialValue: number
+    initialValue: unknown
   ): void;
-  getGlobalValue(instance: OpaqueGlobalNativeHandle): number;
-  setGlobalValue(instance: OpaqueGlobalNativeHandle, newValue: number): void;
+  getGlobalValue(instance: OpaqueGlobalNativeHandle): unknown;
+  setGlobalValue(instance: OpaqueGlobalNativeHandle, newValue: unknown): void;
 
   // Tables
   createTable(
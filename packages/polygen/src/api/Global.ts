@@ -22,6 +22,13 @@ export interface GlobalDescriptor {
   mutable?: boolean;
 }
 
+/**
+ * Value of a global variable.
+ *
+ * 64-bit integer globals hold `bigint` values, all other types hold numbers.
+ */
+export type GlobalValue = number | bigint;
+
 /**
  * Helper function checking if specified object is a global descriptor.
  *
@@ -46,7 +53,7 @@ const TypeMapping: Record<WebAssemblyType, NativeType> = {
 export class Global {
   constructor(
     instance: OpaqueMemoryNativeHandle | GlobalDescriptor,
-    initialValue?: number
+    initialValue?: GlobalValue
   ) {
     if (isGlobalDescriptor(instance)) {
       NativeWASM.createGlobal(
@@ -66,11 +73,11 @@ export class Global {
     }
   }
 
-  get value() {
-    return NativeWASM.getGlobalValue(this);
+  get value(): GlobalValue {
+    return NativeWASM.getGlobalValue(this) as GlobalValue;
   }
 
-  set value(newValue: number) {
+  set value(newValue: GlobalValue) {
     NativeWASM.setGlobalValue(this, newValue);
   }
 }
@@ -1,5 +1,4 @@
-import NativeWASM, { type InternalModuleMetadata } from '../NativePolygen';
-import { Global } from './Global';
+import NativeWASM from '../NativePolygen';
 import { Memory } from './Memory';
 import { Module } from './Module';
 import { Table } from './Table';
@@ -13,71 +12,199 @@ export class Instance {
   public exports: any;
   private memories: Record<string, object> = {};
   private tables: Record<string, object> = {};
+  private resultBuffer?: ArrayBuffer;
+
+  /**
+   * Values returned by the last call of an exported function using the result buffer.
+   *
+   * Only present when `bridge.multiValueResultBuffer` is enabled in module configuration.
+   * The buffer is reused, so values must be read before calling any such function again.
+   *
+   * This is a Polygen extension to the WebAssembly API.
+   */
+  public readonly results?: Float64Array;
 
   constructor(module: Module, imports: ImportObject = {}) {
     this.#imports = imports;
 
-    if (module instanceof Module) {
-      validateImports(imports, module.metadata);
-    } else {
+    if (!(module instanceof Module)) {
       throw new TypeError('Invalid module type');
     }
 
-    NativeWASM.createModuleInstance(this, module, imports);
+    // Imports are validated natively, while linking them to the instance
+    try {
+      NativeWASM.createModuleInstance(this, module, imports);
+    } catch (e) {
+      throw toLinkError(e);
+    }
+
+    Instance.exposeExports(this);
+  }
 
-    for (const memoryName in this.memories) {
-      this.exports[memoryName] = new Memory(this.memories[memoryName]!);
+  /**
+   * Creates an instance, instantiating the module on a native thread.
+   *
+   * Imports are linked on the JavaScript thread, while memories and tables are
+   * allocated and initialized on a native thread, so the JavaScript thread is not
+   * blocked while instantiating large modules. The start function of the module, if any,
+   * also runs on the native thread, with imports it calls dispatched to the JavaScript thread.
+   *
+   * This is a Polygen extension to the WebAssembly API.
+   *
+   * @param module Module to instantiate
+   * @param imports Imports of the new instance
+   */
+  public static async instantiate(
+    module: Module,
+    imports: ImportObject = {}
+  ): Promise<Instance> {
+    if (!(module instanceof Module)) {
+      throw new TypeError('Invalid module type');
     }
 
-    for (const tableName in this.tables) {
-      this.exports[tableName] = new Table(this.tables[tableName]!);
+    const instance: Instance = Object.create(Instance.prototype);
+    try {
+      await NativeWASM.createModuleInstanceAsync(instance, module, imports);
+    } catch (e) {
+      throw toLinkError(e);
     }
+
+    Instance.exposeExports(instance);
+    return instance;
+  }
+
+  /**
+   * Creates an instance which is instantiated on first access to its exports.
+   *
+   * Imports are linked right away, so missing imports still throw `LinkError`. Memories
+   * and tables are allocated and initialized, and the start function is called, only once
+   * any export is accessed, so instances that are never used do not take any memory.
+   * Errors of instantiation, e.g. traps of the start function, are thrown by that access.
+   *
+   * This is a Polygen extension to the WebAssembly API.
+   *
+   * @param module Module to instantiate
+   * @param imports Imports of the new instance
+   */
+  public static createLazy(
+    module: Module,
+    imports: ImportObject = {}
+  ): Instance {
+    if (!(module instanceof Module)) {
+      throw new TypeError('Invalid module type');
+    }
+
+    const instance: Instance = Object.create(Instance.prototype);
+    try {
+      NativeWASM.createLazyModuleInstance(instance, module, imports);
+    } catch (e) {
+      throw toLinkError(e);
+    }
+
+    Instance.exposeExports(instance);
+    return instance;
   }
-}
 
-function validateImports(
-  imports: ImportObject,
-  metadata: InternalModuleMetadata
-) {
-  for (const importDesc of metadata.imports) {
-    const mod = imports[importDesc.module];
-    if (!mod) {
-      throw new LinkError(
-        `Imported module ${importDesc.module} is not provided`
-      );
+  private static exposeExports(instance: Instance) {
+    for (const memoryName in instance.memories) {
+      instance.exports[memoryName] = new Memory(instance.memories[memoryName]!);
     }
 
-    const value = mod[importDesc.name];
-    if (!value) {
-      throw new LinkError(
-        `Imported symbol ${importDesc.module}.${importDesc.name} is not provided`
-      );
+    for (const tableName in instance.tables) {
+      instance.exports[tableName] = new Table(instance.tables[tableName]!);
     }
 
-    switch (importDesc.kind) {
-      case 'function':
-        if (typeof value !== 'function') {
-          throw new TypeError(
-            `Imported symbol ${importDesc.module}.${importDesc.name} is not a function`
-          );
-        }
-        break;
-      case 'global':
-        if (!(value instanceof Global)) {
-          throw new TypeError(
-            `Imported symbol ${importDesc.module}.${importDesc.name} is not a global`
-          );
-        }
-        break;
-      case 'memory':
-        if (!(value instanceof Memory)) {
-          throw new TypeError(
-            `Imported symbol ${importDesc.module}.${importDesc.name} is not a memory`
-          );
-        }
-        break;
-      case 'table':
-        throw new Error('Importing tables is not yet supported');
+    if (instance.resultBuffer) {
+      // @ts-ignore: set once, right after the instance is created
+      instance.results = new Float64Array(instance.resultBuffer);
     }
   }
+
+  /**
+   * Calls exported function `count` times in a single native call.
+   *
+   * Arguments of consecutive calls are read from `args`, and results are written
+   * to `results`, both laid out one call after another. Only functions taking and
+   * returning numbers, with at most one result, can be called this way. Functions
+   * taking or returning 64-bit integers cannot, as they would lose precision.
+   *
+   * This is a Polygen extension to the WebAssembly API.
+   *
+   * @param name Name of the exported function
+   * @param args Arguments of all calls
+   * @param results Buffer receiving results of all calls
+   * @param count Number of calls to make
+   */
+  public callBatch(
+    name: string,
+    args: Float64Array,
+    results: Float64Array,
+    count: number
+  ): void {
+    NativeWASM.callExportBatch(this, name, args, results, count);
+  }
+
+  /**
+   * Replaces functions imported by the instance with ones from another import object.
+   *
+   * Imported functions are resolved once, when the instance is created, so calling them
+   * does not look them up in the import object again. This is the only way to change them
+   * afterwards. The import object must provide all imports of the module, same as when
+   * creating an instance, but imported memories, tables and globals are not replaced.
+   *
+   * This is a Polygen extension to the WebAssembly API.
+   *
+   * @param imports Import object to take imported functions from
+   */
+  public rebindImports(imports: ImportObject): void {
+    try {
+      NativeWASM.rebindModuleInstanceImports(this, imports);
+    } catch (e) {
+      throw toLinkError(e);
+    }
+  }
+
+  /**
+   * Saves memories, globals and tables of the instance to a snapshot file.
+   *
+   * Only instances of modules with `bridge.snapshot` option enabled can be saved.
+   * Memories and globals of imported modules are not part of the snapshot.
+   *
+   * This is a Polygen extension to the WebAssembly API.
+   *
+   * @param path Path of the snapshot file, replaced once the snapshot is complete
+   */
+  public snapshot(path: string): void {
+    NativeWASM.snapshotModuleInstance(this, path);
+  }
+
+  /**
+   * Creates an instance with state restored from a snapshot file saved by `snapshot()`.
+   *
+   * Memories are mapped from the file, so their pages are only read when accessed,
+   * and modifying them does not change the file. The start function of the module,
+   * if any, runs before the state is restored.
+   *
+   * This is a Polygen extension to the WebAssembly API.
+   *
+   * @param module Module the snapshot was saved from
+   * @param imports Imports of the new instance
+   * @param path Path of the snapshot file
+   */
+  public static restore(
+    module: Module,
+    imports: ImportObject,
+    path: string
+  ): Instance {
+    const instance = new Instance(module, imports);
+    NativeWASM.restoreModuleInstance(instance, path);
+    return instance;
+  }
+}
+
+function toLinkError(e: unknown): unknown {
+  if (e instanceof Error && e.name === 'LinkError') {
+    return new LinkError(e.message);
+  }
+  return e;
 }
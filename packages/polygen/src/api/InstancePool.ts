@@ -0,0 +1,76 @@
+import NativeWASM from '../NativePolygen';
+import { Instance } from './Instance';
+import { Module } from './Module';
+import type { ImportObject } from './WebAssembly';
+
+/**
+ * Pool of instances of a single module, sharing the same import object.
+ *
+ * Released instances are reset to the state of a newly created instance, and handed out
+ * again by `acquire()`. Resetting an instance reuses its memory reservations, so it is
+ * considerably cheaper than creating a new instance.
+ *
+ * This is a Polygen extension to the WebAssembly API.
+ */
+export class InstancePool {
+  #module: Module;
+  #imports: ImportObject;
+  #available: Instance[] = [];
+  #created = new WeakSet<Instance>();
+
+  constructor(module: Module, imports: ImportObject = {}) {
+    if (!(module instanceof Module)) {
+      throw new TypeError('Invalid module type');
+    }
+
+    this.#module = module;
+    this.#imports = imports;
+  }
+
+  /**
+   * Number of released instances waiting to be acquired.
+   */
+  get size(): number {
+    return this.#available.length;
+  }
+
+  /**
+   * Returns a released instance, or creates a new one if there is none.
+   */
+  public acquire(): Instance {
+    const instance = this.#available.pop();
+    if (instance) {
+      return instance;
+    }
+
+    const created = new Instance(this.#module, this.#imports);
+    this.#created.add(created);
+    return created;
+  }
+
+  /**
+   * Resets the instance and returns it to the pool.
+   *
+   * The instance must have been acquired from this pool, and must not be used
+   * after it is released. If resetting fails, e.g. when the start function traps,
+   * the instance is dropped from the pool and the error is rethrown.
+   *
+   * @param instance Instance to release
+   */
+  public release(instance: Instance): void {
+    if (!this.#created.has(instance)) {
+      throw new TypeError('Instance was not acquired from this pool');
+    }
+    if (this.#available.includes(instance)) {
+      throw new TypeError('Instance was already released');
+    }
+
+    try {
+      NativeWASM.resetModuleInstance(instance);
+    } catch (error) {
+      this.#created.delete(instance);
+      throw error;
+    }
+    this.#available.push(instance);
+  }
+}
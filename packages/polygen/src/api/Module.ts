@@ -31,12 +31,60 @@ export class Module {
     }
   }
 
+  /**
+   * Loads a module from a file, without reading its contents into JavaScript memory.
+   *
+   * The file is identified natively, so it must be one of the precompiled modules.
+   * Only modules loaded from files can be accepted without hashing by the `cached`
+   * module verification, modules created from buffers are always verified in full.
+   *
+   * @param path Absolute path to the `.wasm` file
+   */
+  public static fromFile(path: string): Module {
+    const mod: Module = Object.create(Module.prototype);
+    try {
+      mod.metadata = NativeWASM.loadModuleFromFile(mod, path);
+    } catch (e) {
+      throw new CompileError((e as Error).message);
+    }
+    return mod;
+  }
+
+  /**
+   * Loads multiple modules at once, from buffers or file paths.
+   *
+   * Modules are identified in parallel on native threads, so the JavaScript thread
+   * is not blocked while their contents are hashed.
+   *
+   * @param sources Module buffers, or absolute paths to `.wasm` files
+   */
+  public static async loadAll(
+    sources: (ArrayBuffer | string)[]
+  ): Promise<Module[]> {
+    const modules: Module[] = sources.map(() =>
+      Object.create(Module.prototype)
+    );
+    let metadata: InternalModuleMetadata[];
+    try {
+      metadata = await NativeWASM.loadModules(modules, sources);
+    } catch (e) {
+      throw new CompileError((e as Error).message);
+    }
+
+    modules.forEach((mod, i) => {
+      mod.metadata = metadata[i]!;
+    });
+    return modules;
+  }
+
+  // Metadata is frozen and shared by all modules loaded from the same source,
+  // so every call returns a new array, same as in the WebAssembly JS API
   public static imports(mod: Module): ModuleImportDescriptor[] {
-    return mod.metadata.imports;
+    return mod.metadata.imports.slice();
   }
 
   public static exports(mod: Module): ModuleExportDescriptor[] {
-    return mod.metadata.exports;
+    return mod.metadata.exports.slice();
   }
 }
 
@@ -54,15 +54,24 @@ export async function compileStreaming(
   return compile(buffer);
 }
 
+/**
+ * Instantiates the provided WebAssembly module.
+ *
+ * Unlike `new WebAssembly.Instance()`, the module is instantiated on a native thread,
+ * so the JavaScript thread is not blocked while memories are initialized.
+ *
+ * @param source Module, or buffer containing the module to compile and instantiate
+ * @param imports Imports of the new instance
+ */
 export async function instantiate(
   source: Module | BufferSource,
   imports: ImportObject = {}
 ): Promise<Instance> {
   if (source instanceof Module) {
-    return new Instance(source, imports);
+    return Instance.instantiate(source, imports);
   } else {
     const module = await compile(source);
-    return new Instance(module, imports);
+    return Instance.instantiate(module, imports);
   }
 }
 
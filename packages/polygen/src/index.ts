@@ -1,5 +1,6 @@
 import { Global } from './api/Global';
 import { Instance } from './api/Instance';
+import { InstancePool } from './api/InstancePool';
 import { Memory } from './api/Memory';
 import { Module } from './api/Module';
 import { Table } from './api/Table';
@@ -20,6 +21,7 @@ const impl = {
   validate,
   Module,
   Instance,
+  InstancePool,
   Memory,
   Global,
   Table,